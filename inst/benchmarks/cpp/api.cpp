@@ -0,0 +1,193 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// api.cpp: Rcpp R/C++ interface class library -- benchmarks of Function, Module, Environment and DataFrame
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Rcpp.h>
+#include <Rcpp/Benchmark/Benchmark.h>
+using namespace Rcpp ;
+
+class Counter {
+public:
+    Counter() : count(0){}
+    void inc(){ count++ ; }
+    int add( int n ){ count += n ; return count ; }
+    int get() const { return count ; }
+    void reset(){ count = 0 ; }
+    int reset_to( int n ){ int old = count ; count = n ; return old ; }
+private:
+    int count ;
+} ;
+
+RCPP_MODULE(bench_module){
+    class_<Counter>( "Counter" )
+        .constructor()
+        .method( "inc", &Counter::inc )
+        .method( "add", &Counter::add )
+        .method( "get", &Counter::get )
+        // void and non void overloads, methods without arguments accept
+        // any number of arguments so they go last
+        .method( "reset", &Counter::reset_to )
+        .method( "reset", &Counter::reset )
+        ;
+}
+
+struct call_function {
+    call_function( Function f_, SEXP x_ ) : f(f_), x(x_){}
+    void operator()() const { Shield<SEXP> res( f( x ) ) ; }
+    Function f ;
+    RObject x ;
+} ;
+
+struct call_method {
+    call_method( Function method_ ) : method(method_){}
+    void operator()() const { Shield<SEXP> res( method() ) ; }
+    Function method ;
+} ;
+
+struct call_method_arg {
+    call_method_arg( Function method_ ) : method(method_){}
+    void operator()() const { Shield<SEXP> res( method( 1 ) ) ; }
+    Function method ;
+} ;
+
+// one call per object, as from R
+struct call_each {
+    call_each( List methods_ ) : methods(methods_){}
+    void operator()() const {
+        for( int i=0; i<methods.size(); i++){
+            Function method = methods[i] ;
+            Shield<SEXP> res( method( 1 ) ) ;
+        }
+    }
+    List methods ;
+} ;
+
+struct call_batch {
+    call_batch( Function invoke_, List objects_ ) : invoke(invoke_), objects(objects_){}
+    void operator()() const { Shield<SEXP> res( invoke( objects, "add", 1 ) ) ; }
+    Function invoke ;
+    List objects ;
+} ;
+
+struct create_data_frame {
+    create_data_frame( NumericVector x_, IntegerVector y_, CharacterVector z_ ) : x(x_), y(y_), z(z_){}
+    void operator()() const {
+        DataFrame res = DataFrame::create( _["x"] = x, _["y"] = y, _["z"] = z ) ;
+    }
+    NumericVector x ;
+    IntegerVector y ;
+    CharacterVector z ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_function(){
+    Function identity( "identity" ), length( "length" ) ;
+    NumericVector x( 10 ) ;
+    Benchmark bench( 100, 5, 100 ) ;
+    bench.run( "identity( x )", call_function( identity, x ) )
+         .run( "length( x )", call_function( length, x ) ) ;
+    return bench ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_module( Environment env ){
+    Environment methods = Environment::namespace_env( "methods" ) ;
+    Function new_ = methods["new"], dollar( "$" ) ;
+    RObject counter = new_( dollar( env["bench_module"], "Counter" ) ) ;
+    Benchmark bench( 100, 5, 100 ) ;
+    bench.run( "obj$inc()", call_method( dollar( counter, "inc" ) ) )
+         .run( "obj$get()", call_method( dollar( counter, "get" ) ) )
+         .run( "obj$add( 1L )", call_method_arg( dollar( counter, "add" ) ) )
+         .run( "obj$reset()", call_method( dollar( counter, "reset" ) ) )
+         .run( "obj$reset( 1L )", call_method_arg( dollar( counter, "reset" ) ) ) ;
+    return bench ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_module_batch( Environment env ){
+    Environment methods = Environment::namespace_env( "methods" ) ;
+    Function new_ = methods["new"], dollar( "$" ) ;
+    Function invokeBatch = Environment::namespace_env( "Rcpp" )["invokeBatch"] ;
+    RObject klass = dollar( env["bench_module"], "Counter" ) ;
+    int n = 1000 ;
+    List objects( n ), adds( n ) ;
+    for( int i=0; i<n; i++){
+        SEXP object = new_( klass ) ;
+        objects[i] = object ;
+        adds[i] = dollar( object, "add" ) ;
+    }
+    Benchmark bench( 20, 2 ) ;
+    bench.run( "obj$add( 1L ) for 1000 objects", call_each( adds ) )
+         .run( "invokeBatch( objs, \"add\", 1L )", call_batch( invokeBatch, objects ) ) ;
+    return bench ;
+}
+
+template <typename NAME>
+struct env_get {
+    env_get( Environment env_, NAME name_ ) : env(env_), name(name_){}
+    void operator()() const { SEXP res = env.get( name ) ; (void)res ; }
+    Environment env ;
+    NAME name ;
+} ;
+
+template <typename NAME>
+struct env_assign {
+    env_assign( Environment env_, NAME name_ ) : env(env_), name(name_){}
+    void operator()() const { env.assign( name, R_NilValue ) ; }
+    Environment env ;
+    NAME name ;
+} ;
+
+template <typename NAME>
+struct get_attr {
+    get_attr( NumericVector x_, NAME name_ ) : x(x_), name(name_){}
+    void operator()() const { SEXP res = x.attr( name ) ; (void)res ; }
+    NumericVector x ;
+    NAME name ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_environment(){
+    Environment env = Environment::global_env().new_child( true ) ;
+    env.assign( "x", 1 ) ;
+    NumericVector x( 10 ) ;
+    x.attr( "foo" ) = 1 ;
+    std::string name( "x" ), attr( "foo" ) ;
+    RCPP_CACHED_SYMBOL( sym_x, "x" ) ;
+    RCPP_CACHED_SYMBOL( sym_foo, "foo" ) ;
+    Benchmark bench( 1000, 5, 1000 ) ;
+    bench.run( "env.get( std::string )", env_get<std::string>( env, name ) )
+         .run( "env.get( Symbol )", env_get<Symbol>( env, sym_x ) )
+         .run( "env.assign( std::string )", env_assign<std::string>( env, name ) )
+         .run( "env.assign( Symbol )", env_assign<Symbol>( env, sym_x ) )
+         .run( "x.attr( std::string )", get_attr<std::string>( x, attr ) )
+         .run( "x.attr( Symbol )", get_attr<Symbol>( x, sym_foo ) ) ;
+    return bench ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_data_frame(){
+    NumericVector x = rnorm( 1e4 ) ;
+    IntegerVector y = seq_len( 1e4 ) ;
+    CharacterVector z( 1e4, "a" ) ;
+    Benchmark bench( 100, 5, 10 ) ;
+    bench.run( "DataFrame::create", create_data_frame( x, y, z ) ) ;
+    return bench ;
+}
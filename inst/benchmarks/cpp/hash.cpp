@@ -0,0 +1,195 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// hash.cpp: Rcpp R/C++ interface class library -- benchmarks of the hash based sugar functions
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Rcpp.h>
+#include <Rcpp/Benchmark/Benchmark.h>
+using namespace Rcpp ;
+
+template <int RTYPE>
+struct unique_sugar {
+    unique_sugar( Vector<RTYPE> x_ ) : x(x_){}
+    void operator()() const { Vector<RTYPE> res = unique( x ) ; }
+    Vector<RTYPE> x ;
+} ;
+
+template <int RTYPE>
+struct sort_unique_sugar {
+    sort_unique_sugar( Vector<RTYPE> x_ ) : x(x_){}
+    void operator()() const { Vector<RTYPE> res = sort_unique( x ) ; }
+    Vector<RTYPE> x ;
+} ;
+
+template <int RTYPE>
+struct match_sugar {
+    match_sugar( Vector<RTYPE> x_, Vector<RTYPE> table_ ) : x(x_), table(table_){}
+    void operator()() const { IntegerVector res = match( x, table ) ; }
+    Vector<RTYPE> x, table ;
+} ;
+
+template <int RTYPE>
+struct is_in_sugar {
+    is_in_sugar( Vector<RTYPE> x_, Vector<RTYPE> table_ ) : x(x_), table(table_){}
+    void operator()() const { LogicalVector res = is_in( x, table ) ; }
+    Vector<RTYPE> x, table ;
+} ;
+
+template <int RTYPE>
+struct setdiff_sugar {
+    setdiff_sugar( Vector<RTYPE> x_, Vector<RTYPE> y_ ) : x(x_), y(y_){}
+    void operator()() const { Vector<RTYPE> res = setdiff( x, y ) ; }
+    Vector<RTYPE> x, y ;
+} ;
+
+template <int RTYPE>
+struct intersect_sugar {
+    intersect_sugar( Vector<RTYPE> x_, Vector<RTYPE> y_ ) : x(x_), y(y_){}
+    void operator()() const { Vector<RTYPE> res = intersect( x, y ) ; }
+    Vector<RTYPE> x, y ;
+} ;
+
+template <int RTYPE>
+struct union_sugar {
+    union_sugar( Vector<RTYPE> x_, Vector<RTYPE> y_ ) : x(x_), y(y_){}
+    void operator()() const { Vector<RTYPE> res = union_( x, y ) ; }
+    Vector<RTYPE> x, y ;
+} ;
+
+// the set operations as they were before using IndexHash: a node based
+// set is built from each argument
+
+template <int RTYPE>
+struct node_set {
+    typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+    typedef RCPP_UNORDERED_SET<STORAGE> SET ;
+
+    static inline const STORAGE* begin( const Vector<RTYPE>& x ){ return internal::r_vector_start<RTYPE>( x ) ; }
+    static inline const STORAGE* end( const Vector<RTYPE>& x ){ return begin( x ) + x.size() ; }
+
+    static Vector<RTYPE> get( const SET& set ){
+        Vector<RTYPE> out = no_init( set.size() ) ;
+        std::copy( set.begin(), set.end(), out.begin() ) ;
+        return out ;
+    }
+} ;
+
+template <int RTYPE>
+struct setdiff_node_set {
+    typedef node_set<RTYPE> NS ;
+    setdiff_node_set( Vector<RTYPE> x_, Vector<RTYPE> y_ ) : x(x_), y(y_){}
+    void operator()() const {
+        typename NS::SET lhs( NS::begin( x ), NS::end( x ) ), rhs( NS::begin( y ), NS::end( y ) ) ;
+        for( typename NS::SET::const_iterator it = rhs.begin(); it != rhs.end(); ++it) lhs.erase( *it ) ;
+        Vector<RTYPE> res = NS::get( lhs ) ;
+    }
+    Vector<RTYPE> x, y ;
+} ;
+
+template <int RTYPE>
+struct intersect_node_set {
+    typedef node_set<RTYPE> NS ;
+    intersect_node_set( Vector<RTYPE> x_, Vector<RTYPE> y_ ) : x(x_), y(y_){}
+    void operator()() const {
+        typename NS::SET lhs( NS::begin( x ), NS::end( x ) ), rhs( NS::begin( y ), NS::end( y ) ), res_set ;
+        for( typename NS::SET::const_iterator it = lhs.begin(); it != lhs.end(); ++it){
+            if( rhs.find( *it ) != rhs.end() ) res_set.insert( *it ) ;
+        }
+        Vector<RTYPE> res = NS::get( res_set ) ;
+    }
+    Vector<RTYPE> x, y ;
+} ;
+
+template <int RTYPE>
+struct union_node_set {
+    typedef node_set<RTYPE> NS ;
+    union_node_set( Vector<RTYPE> x_, Vector<RTYPE> y_ ) : x(x_), y(y_){}
+    void operator()() const {
+        typename NS::SET res_set( NS::begin( x ), NS::end( x ) ) ;
+        res_set.insert( NS::begin( y ), NS::end( y ) ) ;
+        Vector<RTYPE> res = NS::get( res_set ) ;
+    }
+    Vector<RTYPE> x, y ;
+} ;
+
+template <int RTYPE>
+DataFrame bench_sets( Vector<RTYPE> x, Vector<RTYPE> y ){
+    Benchmark bench( 20 ) ;
+    bench.run( "setdiff", setdiff_sugar<RTYPE>( x, y ) )
+         .run( "setdiff (node based sets)", setdiff_node_set<RTYPE>( x, y ) )
+         .run( "intersect", intersect_sugar<RTYPE>( x, y ) )
+         .run( "intersect (node based sets)", intersect_node_set<RTYPE>( x, y ) )
+         .run( "union_", union_sugar<RTYPE>( x, y ) )
+         .run( "union_ (node based sets)", union_node_set<RTYPE>( x, y ) ) ;
+    return bench ;
+}
+
+template <int RTYPE>
+struct table_sugar {
+    table_sugar( Vector<RTYPE> x_ ) : x(x_){}
+    void operator()() const { IntegerVector res = table( x ) ; }
+    Vector<RTYPE> x ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_hash_integer(){
+    Function sample( "sample" ) ;
+    IntegerVector x = sample( 1e4, 1e6, true ) ;
+    IntegerVector y = sample( 1e4, 1e5, true ) ;
+    Benchmark bench( 50 ) ;
+    bench.run( "unique", unique_sugar<INTSXP>( x ) )
+         .run( "sort_unique", sort_unique_sugar<INTSXP>( x ) )
+         .run( "match", match_sugar<INTSXP>( x, y ) )
+         .run( "is_in", is_in_sugar<INTSXP>( x, y ) )
+         .run( "setdiff", setdiff_sugar<INTSXP>( x, y ) )
+         .run( "table", table_sugar<INTSXP>( x ) ) ;
+    return bench ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_hash_character(){
+    Function sample( "sample" ), paste0( "paste0" ) ;
+    CharacterVector words = paste0( "w", seq_len( 1e4 ) ) ;
+    CharacterVector x = sample( words, 1e6, true ) ;
+    CharacterVector y = sample( words, 1e5, true ) ;
+    Benchmark bench( 50 ) ;
+    bench.run( "unique", unique_sugar<STRSXP>( x ) )
+         .run( "sort_unique", sort_unique_sugar<STRSXP>( x ) )
+         .run( "match", match_sugar<STRSXP>( x, y ) )
+         .run( "is_in", is_in_sugar<STRSXP>( x, y ) )
+         .run( "setdiff", setdiff_sugar<STRSXP>( x, y ) ) ;
+    return bench ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_sets_integer(){
+    Function sample( "sample" ) ;
+    IntegerVector x = sample( 1e6, 1e6, true ) ;
+    IntegerVector y = sample( 1e6, 1e6, true ) ;
+    return bench_sets<INTSXP>( x, y ) ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_sets_character(){
+    Function sample( "sample" ), paste0( "paste0" ) ;
+    CharacterVector words = paste0( "w", seq_len( 1e5 ) ) ;
+    CharacterVector x = sample( words, 1e6, true ) ;
+    CharacterVector y = sample( words, 1e6, true ) ;
+    return bench_sets<STRSXP>( x, y ) ;
+}
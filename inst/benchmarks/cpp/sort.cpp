@@ -0,0 +1,111 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// sort.cpp: Rcpp R/C++ interface class library -- sorting benchmarks
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Rcpp.h>
+#include <Rcpp/Benchmark/Benchmark.h>
+using namespace Rcpp ;
+
+// both sort a copy of x made in the same way, so that the copy costs the
+// same on each side
+
+template <int RTYPE>
+struct sort_radix {
+    sort_radix( Vector<RTYPE> x_ ) : x(x_), work( x_.size() ){}
+    void operator()() const {
+        std::copy( x.begin(), x.end(), work.begin() ) ;
+        work.sort() ;
+    }
+    Vector<RTYPE> x ;
+    mutable Vector<RTYPE> work ;
+} ;
+
+// what Vector::sort did before the radix sort
+template <int RTYPE>
+struct sort_std {
+    typedef typename traits::storage_type<RTYPE>::type STORAGE ;
+    sort_std( Vector<RTYPE> x_ ) : x(x_), work( x_.size() ){}
+    void operator()() const {
+        std::copy( x.begin(), x.end(), work.begin() ) ;
+        STORAGE* start = internal::r_vector_start<RTYPE>( work ) ;
+        std::sort( start, start + work.size(), internal::NAComparator<STORAGE>() ) ;
+    }
+    Vector<RTYPE> x ;
+    mutable Vector<RTYPE> work ;
+} ;
+
+struct order_radix {
+    order_radix( NumericVector x_ ) : x(x_){}
+    void operator()() const { IntegerVector res = sort_index( x ) ; }
+    NumericVector x ;
+} ;
+
+struct order_index_less {
+    order_index_less( const double* x_ ) : x(x_){}
+    inline bool operator()( int i, int j ) const {
+        return internal::NAComparator<double>()( x[i], x[j] ) ;
+    }
+    const double* x ;
+} ;
+
+struct order_std {
+    order_std( NumericVector x_ ) : x(x_){}
+    void operator()() const {
+        int n = x.size() ;
+        IntegerVector res = no_init( n ) ;
+        for( int i=0; i<n; i++) res[i] = i ;
+        std::stable_sort( res.begin(), res.end(), order_index_less( x.begin() ) ) ;
+    }
+    NumericVector x ;
+} ;
+
+DataFrame bench_sort( int n, int replications ){
+    NumericVector x = rnorm( n ) ;
+    IntegerVector y = IntegerVector( runif( n, -1e9, 1e9 ) ) ;
+    Benchmark bench( replications, 1 ) ;
+    bench.run( "numeric, radix", sort_radix<REALSXP>( x ) )
+         .run( "numeric, std::sort", sort_std<REALSXP>( x ) )
+         .run( "integer, radix", sort_radix<INTSXP>( y ) )
+         .run( "integer, std::sort", sort_std<INTSXP>( y ) )
+         .run( "sort_index, radix", order_radix( x ) )
+         .run( "sort_index, std::stable_sort", order_std( x ) ) ;
+    return bench ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_sort_1e7(){
+    return bench_sort( 1e7, 5 ) ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_sort_1e8(){
+    return bench_sort( 1e8, 3 ) ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_sort_character(){
+    Function sample( "sample" ), paste0( "paste0" ) ;
+    CharacterVector words = paste0( "w", seq_len( 1e5 ) ) ;
+    CharacterVector x = sample( words, 1e7, true ) ;
+    Benchmark bench( 5, 1 ) ;
+    bench.run( "radix", sort_radix<STRSXP>( x ) )
+         .run( "std::sort", sort_std<STRSXP>( x ) ) ;
+    return bench ;
+}
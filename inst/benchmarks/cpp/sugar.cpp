@@ -0,0 +1,292 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// sugar.cpp: Rcpp R/C++ interface class library -- sugar benchmarks
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Rcpp.h>
+#include <Rcpp/Benchmark/Benchmark.h>
+using namespace Rcpp ;
+
+struct arith_sugar {
+    arith_sugar( NumericVector x_, NumericVector y_ ) : x(x_), y(y_){}
+    void operator()() const { NumericVector res = x * y + 2.0 * x - y ; }
+    NumericVector x, y ;
+} ;
+
+struct arith_loop {
+    arith_loop( NumericVector x_, NumericVector y_ ) : x(x_), y(y_){}
+    void operator()() const {
+        int n = x.size() ;
+        NumericVector res = no_init(n) ;
+        for( int i=0; i<n; i++) res[i] = x[i] * y[i] + 2.0 * x[i] - y[i] ;
+    }
+    NumericVector x, y ;
+} ;
+
+struct ifelse_sugar {
+    ifelse_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = ifelse( x < 0.0, -x, x ) ; }
+    NumericVector x ;
+} ;
+
+struct cumsum_sugar {
+    cumsum_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = cumsum( x ) ; }
+    NumericVector x ;
+} ;
+
+struct sum_sugar {
+    sum_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { result = sum( x * x ) ; }
+    NumericVector x ;
+    mutable double result ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_sugar_arith(){
+    NumericVector x = rnorm( 1e6 ), y = rnorm( 1e6 ) ;
+    Benchmark bench( 50 ) ;
+    bench.run( "x * y + 2 * x - y (sugar)", arith_sugar( x, y ) )
+         .run( "x * y + 2 * x - y (loop)", arith_loop( x, y ) )
+         .run( "sum( x * x )", sum_sugar( x ) )
+         .run( "ifelse( x < 0, -x, x )", ifelse_sugar( x ) )
+         .run( "cumsum( x )", cumsum_sugar( x ) ) ;
+    return bench ;
+}
+
+struct cumsum_loop {
+    cumsum_loop( NumericVector x_ ) : x(x_){}
+    void operator()() const {
+        int n = x.size() ;
+        NumericVector res = no_init(n) ;
+        double s = 0.0 ;
+        for( int i=0; i<n; i++) res[i] = s += x[i] ;
+    }
+    NumericVector x ;
+} ;
+
+struct cumprod_sugar {
+    cumprod_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = cumprod( x ) ; }
+    NumericVector x ;
+} ;
+
+struct cummax_sugar {
+    cummax_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = cummax( x ) ; }
+    NumericVector x ;
+} ;
+
+struct cummin_sugar {
+    cummin_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = cummin( x ) ; }
+    NumericVector x ;
+} ;
+
+struct cumsum_int_sugar {
+    cumsum_int_sugar( IntegerVector x_ ) : x(x_){}
+    void operator()() const { IntegerVector res = cumsum( x ) ; }
+    IntegerVector x ;
+} ;
+
+// the cumulative functions scan in parallel above RCPP_PARALLEL_MIN_SIZE
+// elements when compiled with OpenMP, e.g. with PKG_CXXFLAGS set to
+// $(SHLIB_OPENMP_CXXFLAGS) before running the suite
+DataFrame bench_cumulative( int n, int replications ){
+    // values close to 1 so that cumprod stays finite for a while
+    NumericVector x = runif( n, 0.9999, 1.0001 ) ;
+    IntegerVector y = IntegerVector( runif( n, -10.0, 10.0 ) ) ;
+    Benchmark bench( replications, 1 ) ;
+    bench.run( "cumsum( x ) (loop)", cumsum_loop( x ) )
+         .run( "cumsum( x )", cumsum_sugar( x ) )
+         .run( "cumsum( integer )", cumsum_int_sugar( y ) )
+         .run( "cumprod( x )", cumprod_sugar( x ) )
+         .run( "cummax( x )", cummax_sugar( x ) )
+         .run( "cummin( x )", cummin_sugar( x ) ) ;
+    return bench ;
+}
+
+// [[Rcpp::export]]
+DataFrame bench_sugar_cumulative(){
+    return bench_cumulative( 1e6, 50 ) ;
+}
+
+// 1e8 elements: about 2Gb for the inputs and a result
+// [[Rcpp::export]]
+DataFrame bench_sugar_cumulative_1e8(){
+    return bench_cumulative( 1e8, 3 ) ;
+}
+
+template <bool LOG>
+struct dnorm_sugar {
+    dnorm_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = dnorm( x, 0.5, 2.0, LOG ) ; }
+    NumericVector x ;
+} ;
+
+template <bool LOG>
+struct dnorm_loop {
+    dnorm_loop( NumericVector x_ ) : x(x_){}
+    void operator()() const {
+        int n = x.size() ;
+        NumericVector res = no_init(n) ;
+        for( int i=0; i<n; i++) res[i] = ::Rf_dnorm4( x[i], 0.5, 2.0, LOG ) ;
+    }
+    NumericVector x ;
+} ;
+
+struct dgamma_sugar {
+    dgamma_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = dgamma( x, 2.5, 1.5 ) ; }
+    NumericVector x ;
+} ;
+
+struct dpois_sugar {
+    dpois_sugar( NumericVector x_ ) : x(x_){}
+    void operator()() const { NumericVector res = dpois( x, 4.0 ) ; }
+    NumericVector x ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_sugar_stats(){
+    NumericVector x = rnorm( 1e6 ), y = rexp( 1e6 ), k = rpois( 1e6, 4.0 ) ;
+    Benchmark bench( 50 ) ;
+    bench.run( "dnorm( x ) (sugar)", dnorm_sugar<false>( x ) )
+         .run( "dnorm( x ) (loop)", dnorm_loop<false>( x ) )
+         .run( "dnorm( x, log = TRUE ) (sugar)", dnorm_sugar<true>( x ) )
+         .run( "dnorm( x, log = TRUE ) (loop)", dnorm_loop<true>( x ) )
+         .run( "dgamma( y )", dgamma_sugar( y ) )
+         .run( "dpois( k )", dpois_sugar( k ) ) ;
+    return bench ;
+}
+
+struct filter_logical {
+    filter_logical( NumericVector x_ ) : x(x_){}
+    void operator()() const {
+        LogicalVector keep = ( x > 0.0 ) & ( x < 1.0 ) ;
+        NumericVector res = x[ keep ] ;
+        count = sum( keep ) ;
+    }
+    NumericVector x ;
+    mutable int count ;
+} ;
+
+struct filter_mask {
+    filter_mask( NumericVector x_ ) : x(x_){}
+    void operator()() const {
+        LogicalMask keep = LogicalMask( x > 0.0 ) & LogicalMask( x < 1.0 ) ;
+        NumericVector res = x[ keep ] ;
+        count = sum( keep ) ;
+    }
+    NumericVector x ;
+    mutable int count ;
+} ;
+
+struct combine_logical {
+    combine_logical( LogicalVector a_, LogicalVector b_ ) : a(a_), b(b_){}
+    void operator()() const { count = sum( a & !b ) ; }
+    LogicalVector a, b ;
+    mutable int count ;
+} ;
+
+struct combine_mask {
+    combine_mask( LogicalMask a_, LogicalMask b_ ) : a(a_), b(b_){}
+    void operator()() const { count = sum( a & !b ) ; }
+    LogicalMask a, b ;
+    mutable int count ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_sugar_mask(){
+    NumericVector x = rnorm( 1e6 ) ;
+    LogicalVector a = x > 0.0, b = x > 1.0 ;
+    Benchmark bench( 50 ) ;
+    bench.run( "x[ x > 0 & x < 1 ] (LogicalVector)", filter_logical( x ) )
+         .run( "x[ x > 0 & x < 1 ] (LogicalMask)", filter_mask( x ) )
+         .run( "sum( a & !b ) (LogicalVector)", combine_logical( a, b ) )
+         .run( "sum( a & !b ) (LogicalMask)", combine_mask( a, b ) ) ;
+    return bench ;
+}
+
+struct any_greater {
+    any_greater( NumericVector x_, double value_ ) : x(x_), value(value_){}
+    void operator()() const { res = any( x > value ).is_true() ; }
+    NumericVector x ;
+    double value ;
+    mutable bool res ;
+} ;
+
+struct all_less {
+    all_less( IntegerVector x_, int value_ ) : x(x_), value(value_){}
+    void operator()() const { res = all( x < value ).is_true() ; }
+    IntegerVector x ;
+    int value ;
+    mutable bool res ;
+} ;
+
+struct any_logical {
+    any_logical( LogicalVector x_ ) : x(x_){}
+    void operator()() const { res = any( x ).is_true() ; }
+    LogicalVector x ;
+    mutable bool res ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_sugar_any(){
+    NumericVector x = runif( 1e6 ) ;
+    IntegerVector y = seq_len( 1e6 ) ;
+    LogicalVector none( 1e6, false ) ;
+    Benchmark bench( 100 ) ;
+    bench.run( "any( x > 2.0 ), full scan", any_greater( x, 2.0 ) )
+         .run( "any( x > 0.5 ), early exit", any_greater( x, 0.5 ) )
+         .run( "all( y < 2e6L ), full scan", all_less( y, 2000000 ) )
+         .run( "any( LogicalVector )", any_logical( none ) ) ;
+    return bench ;
+}
+
+struct which_sugar {
+    which_sugar( LogicalVector x_ ) : x(x_){}
+    void operator()() const { res = which( x, true ) ; }
+    LogicalVector x ;
+    mutable IntegerVector res ;
+} ;
+
+struct which_push_back {
+    which_push_back( LogicalVector x_ ) : x(x_){}
+    void operator()() const {
+        std::vector<int> positions ;
+        int n = x.size() ;
+        for( int i=0; i<n; i++){
+            if( x[i] == TRUE ) positions.push_back( i + 1 ) ;
+        }
+        res = IntegerVector( positions.begin(), positions.end() ) ;
+    }
+    LogicalVector x ;
+    mutable IntegerVector res ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_sugar_which(){
+    NumericVector x = runif( 1e6 ) ;
+    LogicalVector keep = x > 0.5 ;
+    Benchmark bench( 50 ) ;
+    bench.run( "which( LogicalVector )", which_sugar( keep ) )
+         .run( "loop and push_back", which_push_back( keep ) ) ;
+    return bench ;
+}
@@ -0,0 +1,62 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// wrap.cpp: Rcpp R/C++ interface class library -- benchmarks of wrap and as
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Rcpp.h>
+#include <Rcpp/Benchmark/Benchmark.h>
+using namespace Rcpp ;
+
+template <typename T>
+struct wrap_stl {
+    wrap_stl( const T& x_ ) : x(x_){}
+    void operator()() const { Shield<SEXP> res( wrap( x ) ) ; }
+    T x ;
+} ;
+
+template <typename T>
+struct as_stl {
+    as_stl( SEXP x_ ) : x(x_){}
+    void operator()() const { T res = as<T>( x ) ; }
+    RObject x ;
+} ;
+
+// [[Rcpp::export]]
+DataFrame bench_wrap_as(){
+    int n = 1e6 ;
+    std::vector<double> doubles( n, 1.5 ) ;
+    std::vector<int> ints( n, 2 ) ;
+    std::vector<std::string> strings( 1e5, "foo" ) ;
+    std::map<std::string,double> map ;
+    for( int i=0; i<1e4; i++) map[ "key" + toString(i) ] = i ;
+
+    NumericVector doubles_r = wrap( doubles ) ;
+    IntegerVector ints_r = wrap( ints ) ;
+    CharacterVector strings_r = wrap( strings ) ;
+
+    Benchmark bench( 50 ) ;
+    bench.run( "wrap( vector<double> )", wrap_stl< std::vector<double> >( doubles ) )
+         .run( "wrap( vector<int> )", wrap_stl< std::vector<int> >( ints ) )
+         .run( "wrap( vector<string> )", wrap_stl< std::vector<std::string> >( strings ) )
+         .run( "wrap( map<string,double> )", wrap_stl< std::map<std::string,double> >( map ) )
+         .run( "as< vector<double> >", as_stl< std::vector<double> >( doubles_r ) )
+         .run( "as< vector<int> >", as_stl< std::vector<int> >( ints_r ) )
+         .run( "as< vector<string> >", as_stl< std::vector<std::string> >( strings_r ) ) ;
+    return bench ;
+}
@@ -6,8 +6,6 @@
 #include <omp.h>
 #endif
 
-#include <R_ext/Utils.h>
-
 /**
  * Base class for interrupt exceptions thrown when user
  * interrupts are detected.
@@ -42,29 +40,6 @@ public:
     std::string detailed_message;
 };
 
-/**
- * Do the actual check for an interrupt.
- * @attention This method should never be called directly.
- * @param[in] dummy Dummy argument.
- */
-static inline void check_interrupt_impl(void* /*dummy*/) {
-    R_CheckUserInterrupt();
-}
-
-/**
- * Call this method to check for user interrupts.
- * This is based on the results of a discussion on the
- * R-devel mailing list, suggested by Simon Urbanek.
- * @attention This method must not be called by any other
- *  thread than the master thread. If called from within
- *  an OpenMP parallel for loop, make sure to check
- *  for omp_get_thread_num()==0 before calling this method!
- * @return True, if a user interrupt has been detected.
- */
-inline bool check_interrupt() {
-    return (R_ToplevelExec(check_interrupt_impl, NULL) == FALSE);
-}
-
 /**
  * Compute pi using the Leibniz formula
  * (a very inefficient approach).
@@ -80,48 +55,36 @@ RcppExport SEXP PiLeibniz(SEXP n, SEXP frequency)
     int n_cycles = Rcpp::as<int>(n);
     int interrupt_check_frequency = Rcpp::as<int>(frequency);
 
-    // user interrupt flag
-    bool interrupt = false;
+    // interrupts are checked by the master thread, at most every
+    // interrupt_check_frequency iterations, other threads only read
+    // the flag it sets
+    Rcpp::ThreadedInterruptPoller poller(interrupt_check_frequency, 0);
 
     double pi = 0;
 #ifdef _OPENMP
 #pragma omp parallel for \
-    shared(interrupt_check_frequency, n_cycles, interrupt)	\
+    shared(n_cycles, poller)	\
     reduction(+:pi)
 #endif
-    for (int i=0; i<n_cycles; i+=interrupt_check_frequency) {
+    for (int j=0; j<n_cycles; ++j) {
 	// check for user interrupt
-	if (interrupt) {
+	if (poller.poll()) {
 	    continue;
 	}
 
-#ifdef _OPENMP
-	if (omp_get_thread_num() == 0) // only in master thread!
-#endif
-	    if (check_interrupt()) {
-		interrupt = true;
-	    }
-
 	// do actual computations
-	int j_end = std::min(i+interrupt_check_frequency, n_cycles);
-	for (int j=i; j<j_end; ++j) {
-	    double summand = 1.0 / (double)(2*j + 1);
-	    if (j % 2 == 0) {
-		pi += summand;
-	    }
-	    else {
-		pi -= summand;
-	    }
+	double summand = 1.0 / (double)(2*j + 1);
+	if (j % 2 == 0) {
+	    pi += summand;
+	}
+	else {
+	    pi -= summand;
 	}
     }
 
-    // additional check, in case frequency was too large
-    if (check_interrupt()) {
-	interrupt = true;
-    }
-
-    // throw exception if interrupt occurred
-    if (interrupt) {
+    // additional check, in case frequency was too large, and throw
+    // exception if interrupt occurred
+    if (poller.poll_now()) {
 	throw interrupt_exception("The computation of pi was interrupted.");
     }
 
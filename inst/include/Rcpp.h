@@ -27,6 +27,7 @@
 #include <RcppCommon.h>
 
 #include <Rcpp/RObject.h>
+#include <Rcpp/Symbol.h>
 
 #include <Rcpp/S4.h>
 #include <Rcpp/Reference.h>
@@ -42,7 +43,6 @@
 #include <Rcpp/Promise.h>
 
 #include <Rcpp/XPtr.h>
-#include <Rcpp/Symbol.h>
 #include <Rcpp/DottedPairImpl.h>
 #include <Rcpp/Function.h>
 #include <Rcpp/Language.h>
@@ -61,8 +61,10 @@
 
 #include <Rcpp/Na_Proxy.h>
 
+#ifndef RCPP_NO_MODULES
 #include <Rcpp/Module.h>
 #include <Rcpp/InternalFunction.h>
+#endif
 
 #ifndef RCPP_NO_SUGAR
 #include <Rcpp/sugar/sugar.h>
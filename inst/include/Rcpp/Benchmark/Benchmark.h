@@ -0,0 +1,159 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// Benchmark.h: Rcpp R/C++ interface class library -- micro benchmarks
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef RCPP_BENCHMARK_BENCHMARK_H
+#define RCPP_BENCHMARK_BENCHMARK_H
+
+#include <Rcpp/Benchmark/Timer.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Rcpp{
+
+    /*
+     * Times functions (anything that can be called as fun()):
+     *
+     *    Benchmark bench( 100 ) ;   // 100 timings of each function
+     *    bench.run( "sugar", fun1 ).run( "loop", fun2 ) ;
+     *    return bench ;             // data frame, one row per function
+     *
+     * Each function is first called a few times without being timed
+     * (warm up), then timed replications times. Each timing covers batch
+     * calls, which helps with functions that are too fast for the clock.
+     * The time it takes to read the clock is measured once and subtracted
+     * from the timings.
+     *
+     * The data frame gives, in nanoseconds per call, the min, quartiles,
+     * 90th percentile, max and mean of the timings, and the processor
+     * time used.
+     */
+    class Benchmark {
+    public:
+        Benchmark( int replications_ = 100, int warmup_ = 5, int batch_ = 1 ) :
+            replications(replications_), warmup(warmup_), batch(batch_),
+            overhead( calibrate() ), results()
+        {
+            if( replications < 1 || batch < 1 ) stop( "replications and batch must be positive" ) ;
+        }
+
+        template <typename Function>
+        Benchmark& run( const std::string& name, Function fun ){
+            for( int i=0; i<warmup; i++) fun() ;
+
+            std::vector<double> times( replications ) ;
+            nanotime_t cpu_start = get_cputime() ;
+            for( int i=0; i<replications; i++){
+                nanotime_t start = get_nanotime() ;
+                for( int j=0; j<batch; j++) fun() ;
+                nanotime_t end = get_nanotime() ;
+                double time = static_cast<double>( end - start ) - overhead ;
+                times[i] = ( time > 0.0 ? time : 0.0 ) / batch ;
+            }
+            double cpu = static_cast<double>( get_cputime() - cpu_start ) / ( replications * batch ) ;
+
+            results.push_back( Result( name, times, cpu ) ) ;
+            return *this ;
+        }
+
+        // nanoseconds it takes to read the clock
+        inline double get_overhead() const { return overhead ; }
+
+        // sorted timings of the i-th function run, in nanoseconds per call
+        inline const std::vector<double>& get_times( int i ) const { return results.at(i).times ; }
+
+        operator SEXP() const {
+            int n = results.size() ;
+            CharacterVector name( n ) ;
+            NumericVector min( n ), lq( n ), median( n ), uq( n ), p90( n ), max( n ), mean( n ), cpu( n ) ;
+            for( int i=0; i<n; i++){
+                const Result& res = results[i] ;
+                name[i] = res.name ;
+                min[i] = res.quantile( 0.0 ) ;
+                lq[i] = res.quantile( 0.25 ) ;
+                median[i] = res.quantile( 0.5 ) ;
+                uq[i] = res.quantile( 0.75 ) ;
+                p90[i] = res.quantile( 0.9 ) ;
+                max[i] = res.quantile( 1.0 ) ;
+                mean[i] = res.mean ;
+                cpu[i] = res.cpu ;
+            }
+            return DataFrame::create(
+                _["name"] = name,
+                _["replications"] = IntegerVector( n, replications ),
+                _["min"] = min,
+                _["lq"] = lq,
+                _["median"] = median,
+                _["uq"] = uq,
+                _["p90"] = p90,
+                _["max"] = max,
+                _["mean"] = mean,
+                _["cpu"] = cpu,
+                _["stringsAsFactors"] = false
+            ) ;
+        }
+
+    private:
+
+        struct Result {
+            Result( const std::string& name_, std::vector<double>& times_, double cpu_ ) :
+                name(name_), times(), mean(0.0), cpu(cpu_)
+            {
+                times.swap( times_ ) ;
+                std::sort( times.begin(), times.end() ) ;
+                for( size_t i=0; i<times.size(); i++) mean += times[i] ;
+                mean /= times.size() ;
+            }
+
+            // same as quantile( times, p ) in R (type 7)
+            double quantile( double p ) const {
+                double h = ( times.size() - 1 ) * p ;
+                size_t lo = static_cast<size_t>( std::floor(h) ) ;
+                if( lo + 1 >= times.size() ) return times[lo] ;
+                return times[lo] + ( h - lo ) * ( times[lo+1] - times[lo] ) ;
+            }
+
+            std::string name ;
+            std::vector<double> times ;
+            double mean ;
+            double cpu ;
+        } ;
+
+        // smallest of a few differences between two reads of the clock
+        static double calibrate(){
+            nanotime_t best = static_cast<nanotime_t>(-1) ;
+            for( int i=0; i<1000; i++){
+                nanotime_t start = get_nanotime() ;
+                nanotime_t end = get_nanotime() ;
+                if( end - start < best ) best = end - start ;
+            }
+            return static_cast<double>( best ) ;
+        }
+
+        int replications ;
+        int warmup ;
+        int batch ;
+        double overhead ;
+        std::vector<Result> results ;
+    } ;
+
+}
+
+#endif
@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include <vector>
 #include <string>
+#include <ctime>
 
 #define R_NO_REMAP
 #include <Rinternals.h>
@@ -66,8 +67,8 @@ namespace Rcpp{
         time = mach_absolute_time();
         mach_timebase_info(&info);
 
-        /* Convert to nanoseconds */
-        return time * (info.numer / info.denom);
+        /* Convert to nanoseconds (numer / denom is not always an integer) */
+        return time * info.numer / info.denom;
     }
 
 #elif defined(linux) || defined(__linux) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__GLIBC__) || defined(__GNU__) || defined(__CYGWIN__)
@@ -77,12 +78,15 @@ namespace Rcpp{
     inline nanotime_t get_nanotime(void) {
         struct timespec time_var;
 
-        /* Possible other values we could have used are CLOCK_MONOTONIC,
-         * which is takes longer to retrieve and CLOCK_PROCESS_CPUTIME_ID
-         * which, if I understand it correctly, would require the R
-         * process to be bound to one core.
+        /* CLOCK_MONOTONIC is not affected by adjustments of the system
+         * time (e.g. by NTP) while a timing is running.
+         * CLOCK_PROCESS_CPUTIME_ID is used by get_cputime below.
          */
-        clock_gettime(CLOCK_REALTIME, &time_var);
+        #if defined(CLOCK_MONOTONIC)
+            clock_gettime(CLOCK_MONOTONIC, &time_var);
+        #else
+            clock_gettime(CLOCK_REALTIME, &time_var);
+        #endif
 
         nanotime_t sec = time_var.tv_sec;
         nanotime_t nsec = time_var.tv_nsec;
@@ -98,6 +102,23 @@ namespace Rcpp{
         return gethrtime();
     }
 
+#endif
+
+    /* processor time used by the process, in nanoseconds */
+#if ( defined(linux) || defined(__linux) || defined(__GLIBC__) ) && defined(CLOCK_PROCESS_CPUTIME_ID)
+
+    inline nanotime_t get_cputime(void) {
+        struct timespec time_var;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time_var);
+        return (nanoseconds_in_second * static_cast<nanotime_t>(time_var.tv_sec)) + time_var.tv_nsec;
+    }
+
+#else
+
+    inline nanotime_t get_cputime(void) {
+        return static_cast<nanotime_t>( 1.0e9 * std::clock() / CLOCKS_PER_SEC );
+    }
+
 #endif
 
     namespace{
@@ -98,9 +98,21 @@ namespace Rcpp{
          * @return a SEXP (possibly R_NilValue)
          */
         SEXP get(const std::string& name) const {
+            return get( Symbol(name) ) ;
+        }
+
+        /**
+         * Get an object from the environment. Symbols can be made once
+         * and reused, e.g. with RCPP_CACHED_SYMBOL, which saves a look
+         * up in R's symbol table at each call
+         *
+         * @param name symbol of the object
+         *
+         * @return a SEXP (possibly R_NilValue)
+         */
+        SEXP get(const Symbol& name) const {
             SEXP env = Storage::get__() ;
-            SEXP nameSym = Rf_install(name.c_str());
-            SEXP res = Rf_findVarInFrame( env, nameSym ) ;
+            SEXP res = Rf_findVarInFrame( env, name ) ;
 
             if( res == R_UnboundValue ) return R_NilValue ;
 
@@ -119,11 +131,21 @@ namespace Rcpp{
          *
          */
         SEXP find( const std::string& name) const{
+            return find( Symbol(name) ) ;
+        }
+
+        /**
+         * Get an object from the environment or one of its
+         * parents
+         *
+         * @param name symbol of the object
+         *
+         */
+        SEXP find( const Symbol& name) const{
             SEXP env = Storage::get__() ;
-            SEXP nameSym = Rf_install(name.c_str());
-            SEXP res = Rf_findVar( nameSym, env ) ;
+            SEXP res = Rf_findVar( name, env ) ;
 
-            if( res == R_UnboundValue ) throw binding_not_found(name) ;
+            if( res == R_UnboundValue ) throw binding_not_found(name.c_str()) ;
 
             /* We need to evaluate if it is a promise */
             if( TYPEOF(res) == PROMSXP){
@@ -141,8 +163,11 @@ namespace Rcpp{
          * @return true if the object exists in the environment
          */
         bool exists( const std::string& name ) const {
-            SEXP nameSym = Rf_install(name.c_str());
-            SEXP res = Rf_findVarInFrame( Storage::get__() , nameSym  ) ;
+            return exists( Symbol(name) ) ;
+        }
+
+        bool exists( const Symbol& name ) const {
+            SEXP res = Rf_findVarInFrame( Storage::get__() , name  ) ;
             return res != R_UnboundValue ;
         }
 
@@ -158,9 +183,12 @@ namespace Rcpp{
          * @throw binding_is_locked if the binding is locked
          */
         bool assign( const std::string& name, SEXP x ) const{
-            if( exists( name) && bindingIsLocked(name) ) throw binding_is_locked(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            Rf_defineVar( nameSym, x, Storage::get__() );
+            return assign( Symbol(name), x ) ;
+        }
+
+        bool assign( const Symbol& name, SEXP x ) const{
+            if( exists( name) && bindingIsLocked(name) ) throw binding_is_locked(name.c_str()) ;
+            Rf_defineVar( name, x, Storage::get__() );
             return true ;
         }
 
@@ -175,6 +203,9 @@ namespace Rcpp{
         template <typename WRAPPABLE>
         bool assign( const std::string& name, const WRAPPABLE& x) const ;
 
+        template <typename WRAPPABLE>
+        bool assign( const Symbol& name, const WRAPPABLE& x) const ;
+
         /**
          * @return true if this environment is locked
          * see ?environmentIsLocked for details of what this means
@@ -222,9 +253,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         void lockBinding(const std::string& name){
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            R_LockBinding( nameSym, Storage::get__() );
+            lockBinding( Symbol(name) ) ;
+        }
+
+        void lockBinding(const Symbol& name){
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            R_LockBinding( name, Storage::get__() );
         }
 
         /**
@@ -234,9 +268,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         void unlockBinding(const std::string& name){
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            R_unLockBinding( nameSym, Storage::get__() );
+            unlockBinding( Symbol(name) ) ;
+        }
+
+        void unlockBinding(const Symbol& name){
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            R_unLockBinding( name, Storage::get__() );
         }
 
         /**
@@ -248,9 +285,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         bool bindingIsLocked(const std::string& name) const{
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            return R_BindingIsLocked(nameSym, Storage::get__() ) ;
+            return bindingIsLocked( Symbol(name) ) ;
+        }
+
+        bool bindingIsLocked(const Symbol& name) const{
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            return R_BindingIsLocked(name, Storage::get__() ) ;
         }
 
         /**
@@ -263,9 +303,12 @@ namespace Rcpp{
          * @throw no_such_binding if there is no such binding in this environment
          */
         bool bindingIsActive(const std::string& name) const {
-            if( !exists( name) ) throw no_such_binding(name) ;
-            SEXP nameSym = Rf_install(name.c_str());
-            return R_BindingIsActive(nameSym, Storage::get__()) ;
+            return bindingIsActive( Symbol(name) ) ;
+        }
+
+        bool bindingIsActive(const Symbol& name) const {
+            if( !exists( name) ) throw no_such_binding(name.c_str()) ;
+            return R_BindingIsActive(name, Storage::get__()) ;
         }
 
         /**
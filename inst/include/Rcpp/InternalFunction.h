@@ -33,7 +33,14 @@ namespace Rcpp{
 
         RCPP_GENERATE_CTOR_ASSIGN(InternalFunction_Impl)
 
+#ifdef RCPP_VARIADIC_MODULES
+        template <typename OUT, typename... U>
+        InternalFunction_Impl( OUT (*fun)(U...) ){
+            set( XPtr< CppFunctionN<OUT,U...> >( new CppFunctionN<OUT,U...>( fun ), false ) ) ;
+        }
+#else
         #include <Rcpp/generated/InternalFunction__ctors.h>
+#endif
         void update(SEXP){}
     private:
 
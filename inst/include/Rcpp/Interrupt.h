@@ -2,7 +2,7 @@
 //
 // Interrupt.h: Rcpp R/C++ interface class library -- check for interrupts
 //
-// Copyright (C) 2009 - 2013    Dirk Eddelbuettel and Romain Francois
+// Copyright (C) 2009 - 2014    Dirk Eddelbuettel and Romain Francois
 //
 // This file is part of Rcpp.
 //
@@ -23,6 +23,26 @@
 #define Rcpp_Interrupt_h
 
 #include <R_ext/GraphicsEngine.h>
+#include <sys/time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if __cplusplus >= 201103L
+#include <atomic>
+#endif
+
+// number of calls to InterruptPoller::poll between two looks at the clock
+#ifndef RCPP_INTERRUPT_CHECK_EVERY
+#define RCPP_INTERRUPT_CHECK_EVERY 1000
+#endif
+
+// minimum time, in milliseconds, between two checks for interrupts by
+// InterruptPoller
+#ifndef RCPP_INTERRUPT_CHECK_INTERVAL
+#define RCPP_INTERRUPT_CHECK_INTERVAL 100
+#endif
 
 namespace Rcpp {
 
@@ -61,6 +81,184 @@ namespace Rcpp {
             throw internal::InterruptedException();
     }
 
+    namespace internal {
+
+        // wall clock time in milliseconds, used to space the checks of
+        // InterruptPoller whatever the number of threads running
+        inline double interrupt_clock() {
+            struct timeval tv ;
+            gettimeofday( &tv, NULL ) ;
+            return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0 ;
+        }
+
+        // the check made by InterruptPoller by default, as in
+        // checkUserInterrupt but without throwing
+        inline bool interrupt_pending() {
+            return R_ToplevelExec(checkInterruptFn, NULL) == FALSE ;
+        }
+
+    }
+
+    // Amortized checks for interrupts in long running loops. poll() is
+    // meant to be called at each iteration: it only decrements a counter,
+    // looks at the clock every `every` calls, and really checks for
+    // interrupts (as checkUserInterrupt does) when at least `interval`
+    // milliseconds have passed since the previous check. The check itself
+    // can be replaced by another function, e.g. to test code using the
+    // poller without a user interrupt.
+    //
+    //     InterruptPoller poller ;
+    //     for( int i=0; i<n; i++){
+    //         poller.check() ;  // throws when interrupted
+    //         ...
+    //     }
+    class InterruptPoller {
+    public:
+        InterruptPoller( int every_ = RCPP_INTERRUPT_CHECK_EVERY,
+                         int interval_ = RCPP_INTERRUPT_CHECK_INTERVAL,
+                         bool (*pending_)() = internal::interrupt_pending ) :
+            every( every_ > 0 ? every_ : 1 ),
+            countdown( every ),
+            interval( interval_ ),
+            last( internal::interrupt_clock() ),
+            pending( pending_ ),
+            interrupted( false )
+        {}
+
+        // true when an interrupt has been detected, by this call or an
+        // earlier one. Must be called from the main thread.
+        inline bool poll() {
+            if( --countdown > 0 ) return interrupted ;
+            return poll_clock() ;
+        }
+
+        // checks right away, whatever the counter and the clock, e.g. once
+        // after a loop. Must be called from the main thread.
+        inline bool poll_now() {
+            countdown = every ;
+            if( interrupted ) return true ;
+            last = internal::interrupt_clock() ;
+            interrupted = pending() ;
+            return interrupted ;
+        }
+
+        // Same as poll, but throws the sentinel exception on interrupt
+        inline void check() {
+            if( poll() ) throw internal::InterruptedException() ;
+        }
+
+        inline bool is_interrupted() const {
+            return interrupted ;
+        }
+
+    private:
+        int every ;
+        int countdown ;
+        // milliseconds
+        double interval ;
+        double last ;
+        bool (*pending)() ;
+        bool interrupted ;
+
+        bool poll_clock() {
+            countdown = every ;
+            if( interrupted ) return true ;
+            if( internal::interrupt_clock() - last < interval ) return false ;
+            return poll_now() ;
+        }
+    } ;
+
+    // Interrupt checks from loops running on several threads (e.g. OpenMP
+    // parallel loops). Only the main thread polls R, through an
+    // InterruptPoller, other threads just read the flag it sets, so they
+    // never wait for each other.
+    //
+    //     ThreadedInterruptPoller poller ;
+    //     #pragma omp parallel for
+    //     for( int i=0; i<n; i++){
+    //         if( poller.poll() ) continue ;
+    //         ...
+    //     }
+    //     poller.check() ;  // main thread, throws when interrupted
+    //
+    // The flag is a std::atomic with C++11, and is read and written with
+    // OpenMP atomics otherwise. Without either, poll() must only be
+    // called from the main thread.
+    class ThreadedInterruptPoller {
+    public:
+        ThreadedInterruptPoller( int every = RCPP_INTERRUPT_CHECK_EVERY,
+                                 int interval = RCPP_INTERRUPT_CHECK_INTERVAL,
+                                 bool (*pending)() = internal::interrupt_pending ) :
+            poller( every, interval, pending ), flag( 0 )
+        {}
+
+        // true when an interrupt has been detected. Can be called from
+        // any thread.
+        inline bool poll() {
+            if( get_flag() ) return true ;
+            if( is_main_thread() && poller.poll() ) set_flag() ;
+            return get_flag() ;
+        }
+
+        // checks right away, e.g. once after a parallel loop so that the
+        // last iterations are covered. Must be called from the main
+        // thread, outside of parallel regions.
+        inline bool poll_now() {
+            if( !get_flag() && poller.poll_now() ) set_flag() ;
+            return get_flag() ;
+        }
+
+        // throws the sentinel exception if an interrupt was detected, by
+        // an earlier poll or by a check made now. Must be called from the
+        // main thread, outside of parallel regions.
+        inline void check() {
+            if( poll_now() ) throw internal::InterruptedException() ;
+        }
+
+        inline bool is_interrupted() const {
+            return get_flag() ;
+        }
+
+    private:
+        InterruptPoller poller ;
+#if __cplusplus >= 201103L
+        std::atomic<int> flag ;
+
+        inline bool get_flag() const { return flag.load( std::memory_order_relaxed ) != 0 ; }
+        inline void set_flag() { flag.store( 1, std::memory_order_relaxed ) ; }
+#else
+        int flag ;
+
+        inline bool get_flag() const {
+            int value ;
+#ifdef _OPENMP
+            #pragma omp atomic read
+#endif
+            value = flag ;
+            return value != 0 ;
+        }
+        inline void set_flag() {
+#ifdef _OPENMP
+            #pragma omp atomic write
+#endif
+            flag = 1 ;
+        }
+#endif
+
+        static inline bool is_main_thread() {
+#ifdef _OPENMP
+            for( int level = omp_get_level(); level > 0; level-- ){
+                if( omp_get_ancestor_thread_num( level ) != 0 ) return false ;
+            }
+#endif
+            return true ;
+        }
+
+        // not copyable
+        ThreadedInterruptPoller( const ThreadedInterruptPoller& ) ;
+        ThreadedInterruptPoller& operator=( const ThreadedInterruptPoller& ) ;
+    } ;
+
 } // namespace Rcpp
 
 #endif
@@ -24,6 +24,14 @@
 
 #include <Rcpp/config.h>
 
+// With variadic templates, the classes behind exposed functions, methods
+// and constructors are written once for all arities rather than once per
+// arity as in the Module_generated_*.h files, which makes modules much
+// cheaper to compile. Defining RCPP_NO_VARIADIC_MODULES keeps the latter.
+#if defined(HAS_VARIADIC_TEMPLATES) && !defined(RCPP_NO_VARIADIC_MODULES)
+#define RCPP_VARIADIC_MODULES
+#endif
+
 namespace Rcpp{
 
     namespace internal{
@@ -85,10 +93,15 @@ namespace Rcpp{
 
 #include <Rcpp/module/CppFunction.h>
 #include <Rcpp/module/get_return_type.h>
+#ifdef RCPP_VARIADIC_MODULES
+#include <Rcpp/module/Module_variadic_get_signature.h>
+#include <Rcpp/module/Module_variadic_CppFunction.h>
+#else
 #include <Rcpp/module/Module_generated_get_signature.h>
 
     // templates CppFunction0, ..., CppFunction65
 #include <Rcpp/module/Module_generated_CppFunction.h>
+#endif
 #include <Rcpp/module/class_Base.h>
 #include <Rcpp/module/Module.h>
 
@@ -130,8 +143,12 @@ namespace Rcpp{
         ParentMethod* parent_method_pointer ;
     } ;
 
+#ifdef RCPP_VARIADIC_MODULES
+#include <Rcpp/module/Module_variadic_Constructor.h>
+#else
 #include <Rcpp/module/Module_generated_ctor_signature.h>
 #include <Rcpp/module/Module_generated_Constructor.h>
+#endif
 #include <Rcpp/module/Module_generated_Factory.h>
 
 #include <Rcpp/module/Module_generated_class_signature.h>
@@ -257,8 +274,12 @@ namespace Rcpp{
 
     } ;
 
+#ifdef RCPP_VARIADIC_MODULES
+#include <Rcpp/module/Module_variadic_CppMethod.h>
+#else
 #include <Rcpp/module/Module_generated_CppMethod.h>
 #include <Rcpp/module/Module_generated_Pointer_CppMethod.h>
+#endif
 
     template <typename Class>
     class CppProperty {
@@ -333,6 +354,7 @@ namespace Rcpp{
     } ;
 
 #include <Rcpp/module/Module_Property.h>
+#include <Rcpp/module/Module_batch.h>
 
 #include <Rcpp/module/class.h>
 
@@ -366,7 +388,11 @@ namespace Rcpp{
 }
 
 // function factories
+#ifdef RCPP_VARIADIC_MODULES
+#include <Rcpp/module/Module_variadic_function.h>
+#else
 #include <Rcpp/module/Module_generated_function.h>
+#endif
 
 namespace Rcpp {
 
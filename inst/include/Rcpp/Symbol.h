@@ -75,4 +75,15 @@ namespace Rcpp{
 
 } // namespace Rcpp
 
+/**
+ * Declares a symbol that is installed the first time the enclosing code
+ * runs and reused afterwards, e.g.
+ *
+ *   RCPP_CACHED_SYMBOL( sym_x, "x" ) ;
+ *   double x = env.get( sym_x ) ;
+ *
+ * Symbols live as long as the R session, so no protection is needed.
+ */
+#define RCPP_CACHED_SYMBOL(VAR,NAME) static const ::Rcpp::Symbol VAR( NAME )
+
 #endif
@@ -29,6 +29,7 @@
 namespace Rcpp{
     namespace traits{
          template <int RTYPE, bool NA, typename VECTOR> struct Extractor ;
+         template <int RTYPE> struct r_vector_direct_access ;
     }
     template <int RTYPE> class MatrixRow ;
     template <int RTYPE> class MatrixColumn ;
@@ -36,6 +37,14 @@ namespace Rcpp{
 
     class Dimension ;
     template <bool NA,typename T> class SingleLogicalResult ;
+    namespace sugar{
+        template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T, typename Function> class Outer ;
+    }
+    namespace stats{
+        template <typename KERNEL, int RTYPE, bool NA, typename T> class DBatch ;
+    }
+    class LogicalMask ;
+    template <int RTYPE, template <class> class StoragePolicy> class MaskSubsetProxy ;
 
 }
 
@@ -63,6 +72,7 @@ namespace Rcpp{
 
 #include <Rcpp/String.h>
 #include <Rcpp/vector/LazyVector.h>
+#include <Rcpp/vector/LogicalMask.h>
 #include <Rcpp/vector/swap.h>
 
 #include <Rcpp/vector/ChildVector.h>
@@ -30,6 +30,12 @@ bool Environment_Impl<StoragePolicy>::assign( const std::string& name, const WRA
     return assign( name, wrap( x ) ) ;
 }
 
+template <template <class> class StoragePolicy>
+template <typename WRAPPABLE>
+bool Environment_Impl<StoragePolicy>::assign( const Symbol& name, const WRAPPABLE& x) const {
+    return assign( name, wrap( x ) ) ;
+}
+
 template <template <class> class StoragePolicy>
 Environment_Impl<StoragePolicy>::Environment_Impl( const std::string& name ){
     Shield<SEXP> wrapped(wrap(name));
@@ -145,6 +145,7 @@ namespace internal{
         return TYPEOF(x) == REALSXP && Rf_inherits( x, "POSIXt" ) ;
     }
 
+#ifndef RCPP_NO_MODULES
     inline bool is_module_object_internal(SEXP obj, const char* clazz){
 	    Environment env(obj) ;
 	    XPtr<class_Base> xp( env.get(".cppclass") );
@@ -154,6 +155,7 @@ namespace internal{
         typedef typename Rcpp::traits::un_pointer<T>::type CLASS ;
         return is_module_object_internal(x, typeid(CLASS).name() ) ;
     }
+#endif
 
 
 } // namespace internal
@@ -82,6 +82,15 @@ namespace Rcpp{
             return *this ;
         }
 
+        /* positions (0-based) of the first occurrence of each distinct
+           value, in the order of the data */
+        inline std::vector<int> fill_and_get_first() {
+            std::vector<int> first ;
+            first.reserve(n) ;
+            for( int i=0; i<n; i++) if( add_value(i) ) first.push_back(i) ;
+            return first ;
+        }
+
         inline LogicalVector fill_and_get_duplicated() {
             LogicalVector result = no_init(n) ;
             int* res = LOGICAL(result) ;
@@ -160,7 +169,7 @@ namespace Rcpp{
         #endif
         }
 
-        inline bool not_equal(const STORAGE& lhs, const STORAGE& rhs) {
+        inline bool not_equal(const STORAGE& lhs, const STORAGE& rhs) const {
             return ! internal::NAEquals<STORAGE>()(lhs, rhs);
         }
 
@@ -188,7 +197,7 @@ namespace Rcpp{
         inline int get_index(STORAGE value) const {
             int addr = get_addr(value) ;
             while (data[addr]) {
-              if (src[data[addr] - 1] == value)
+              if (!not_equal(src[data[addr] - 1], value))
                 return data[addr];
               addr++;
               if (addr == m) addr = 0;
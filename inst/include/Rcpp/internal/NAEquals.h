@@ -31,11 +31,15 @@ struct NAEquals {
     }
 };
 
-// TODO: check different kinds of NA, NaNs
+// equality as in R's match(): 0 equals -0, NA equals NA and NaN equals
+// NaN, but NA and NaN differ (as in the normalization of
+// IndexHash<REALSXP>::get_addr)
 template <>
 struct NAEquals<double> {
     inline bool operator()(double left, double right) const {
-        return memcmp(&left, &right, sizeof(double)) == 0;
+        if (left == right) return true;
+        if (left == left || right == right) return false;
+        return Rcpp_IsNA(left) == Rcpp_IsNA(right);
     }
 };
 
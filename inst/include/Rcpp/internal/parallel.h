@@ -0,0 +1,87 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// parallel.h: Rcpp R/C++ interface class library -- splitting loops across threads
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__internal__parallel__h
+#define Rcpp__internal__parallel__h
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// loops over fewer elements than this always run on the calling thread
+#ifndef RCPP_PARALLEL_MIN_SIZE
+#define RCPP_PARALLEL_MIN_SIZE 100000
+#endif
+
+namespace Rcpp{
+namespace internal{
+
+/**
+ * Number of chunks a loop over n elements is split into. Loops only
+ * run in parallel when the calling code is compiled with OpenMP
+ * support (e.g. using $(SHLIB_OPENMP_CXXFLAGS) in Makevars), otherwise
+ * this is always 1
+ */
+inline int parallel_chunks( R_xlen_t n ){
+#ifdef _OPENMP
+    if( n < RCPP_PARALLEL_MIN_SIZE ) return 1 ;
+    int nthreads = omp_get_max_threads() ;
+    return nthreads > 1 ? nthreads : 1 ;
+#else
+    (void)n ;
+    return 1 ;
+#endif
+}
+
+/**
+ * first index of chunk k when [0,n) is split in nchunks contiguous chunks
+ */
+inline int parallel_chunk_begin( int n, int nchunks, int k ){
+    return static_cast<int>( ( static_cast<double>(n) * k ) / nchunks ) ;
+}
+
+/**
+ * Calls body( k, begin, end ) for each of the nchunks contiguous chunks
+ * [begin,end) of [0,n), possibly from several threads at once (at most
+ * omp_get_max_threads()).
+ *
+ * The body must neither use the R API (which is not thread safe) nor
+ * throw exceptions.
+ */
+template <typename Body>
+inline void parallel_for( int n, int nchunks, const Body& body ){
+    if( nchunks <= 1 ){
+        body( 0, 0, n ) ;
+        return ;
+    }
+#ifdef _OPENMP
+    int nthreads = std::min( nchunks, omp_get_max_threads() ) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+    for( int k=0; k<nchunks; k++){
+        body( k, parallel_chunk_begin(n, nchunks, k), parallel_chunk_begin(n, nchunks, k+1) ) ;
+    }
+}
+
+} // internal
+} // Rcpp
+
+#endif
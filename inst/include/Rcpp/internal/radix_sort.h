@@ -0,0 +1,312 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// radix_sort.h: Rcpp R/C++ interface class library -- radix sort
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__internal__radix_sort__h
+#define Rcpp__internal__radix_sort__h
+
+#include <cstring>
+#include <functional>
+
+// shorter inputs are sorted with std::sort and std::stable_sort
+#ifndef RCPP_RADIX_SORT_MIN_SIZE
+#define RCPP_RADIX_SORT_MIN_SIZE 256
+#endif
+
+namespace Rcpp{
+namespace internal{
+
+/*
+ * Values are mapped to unsigned keys whose natural order is the order of
+ * NAComparator (numbers first, then NA, then NaN), and the keys are sorted
+ * by a least significant digit radix sort, one byte per pass.
+ */
+
+struct radix_double_key {
+    unsigned int hi ;
+    unsigned int lo ;
+} ;
+
+template <typename T> struct radix_key_type ;
+template <> struct radix_key_type<int>{ typedef unsigned int type ; } ;
+template <> struct radix_key_type<double>{ typedef radix_double_key type ; } ;
+
+template <typename KEY> struct radix_key_traits ;
+
+template <> struct radix_key_traits<unsigned int> {
+    enum{ passes = 4 } ;
+    static inline int digit( unsigned int key, int pass ){
+        return ( key >> ( 8 * pass ) ) & 0xFF ;
+    }
+} ;
+
+template <> struct radix_key_traits<radix_double_key> {
+    enum{ passes = 8 } ;
+    static inline int digit( const radix_double_key& key, int pass ){
+        return pass < 4 ? ( key.lo >> ( 8 * pass ) ) & 0xFF : ( key.hi >> ( 8 * ( pass - 4 ) ) ) & 0xFF ;
+    }
+} ;
+
+// NA_INTEGER is the smallest int, it wraps around to the largest key
+inline unsigned int radix_key( int x ){
+    return ( static_cast<unsigned int>( x ) ^ 0x80000000u ) - 1u ;
+}
+
+inline int radix_value( unsigned int key ){
+    return static_cast<int>( ( key + 1u ) ^ 0x80000000u ) ;
+}
+
+inline bool radix_little_endian(){
+    const unsigned int one = 1 ;
+    return *reinterpret_cast<const unsigned char*>( &one ) == 1 ;
+}
+
+inline radix_double_key radix_key( double x ){
+    radix_double_key key ;
+    if( x != x ){
+        key.hi = 0xFFFFFFFFu ;
+        key.lo = Rcpp_IsNA( x ) ? 0xFFFFFFFEu : 0xFFFFFFFFu ;
+        return key ;
+    }
+    unsigned int words[2] ;
+    std::memcpy( words, &x, sizeof(double) ) ;
+    bool little = radix_little_endian() ;
+    key.hi = words[ little ? 1 : 0 ] ;
+    key.lo = words[ little ? 0 : 1 ] ;
+    if( key.hi & 0x80000000u ){
+        key.hi = ~key.hi ;
+        key.lo = ~key.lo ;
+    } else {
+        key.hi |= 0x80000000u ;
+    }
+    return key ;
+}
+
+inline double radix_value( const radix_double_key& key ){
+    if( key.hi == 0xFFFFFFFFu && key.lo >= 0xFFFFFFFEu ){
+        return key.lo == 0xFFFFFFFEu ? NA_REAL : R_NaN ;
+    }
+    unsigned int hi = key.hi, lo = key.lo ;
+    if( hi & 0x80000000u ){
+        hi &= 0x7FFFFFFFu ;
+    } else {
+        hi = ~hi ;
+        lo = ~lo ;
+    }
+    unsigned int words[2] ;
+    bool little = radix_little_endian() ;
+    words[ little ? 1 : 0 ] = hi ;
+    words[ little ? 0 : 1 ] = lo ;
+    double x ;
+    std::memcpy( &x, words, sizeof(double) ) ;
+    return x ;
+}
+
+/**
+ * Stable sort of the n keys. When index is not null, it is permuted
+ * along with the keys.
+ */
+template <typename KEY>
+void radix_sort_keys( KEY* keys, int* index, int n ){
+    typedef radix_key_traits<KEY> traits ;
+    if( n < 2 ) return ;
+
+    // histograms of all the passes in a single read of the keys
+    std::vector<int> counts( traits::passes * 256, 0 ) ;
+    for( int i=0; i<n; i++){
+        for( int pass=0; pass<traits::passes; pass++){
+            counts[ pass * 256 + traits::digit( keys[i], pass ) ]++ ;
+        }
+    }
+
+    std::vector<KEY> key_buffer( n ) ;
+    std::vector<int> index_buffer( index ? n : 0 ) ;
+    KEY* src = keys ;
+    KEY* dest = &key_buffer[0] ;
+    int* src_index = index ;
+    int* dest_index = index ? &index_buffer[0] : 0 ;
+
+    for( int pass=0; pass<traits::passes; pass++){
+        int* count = &counts[ pass * 256 ] ;
+        // skip the passes where all keys share the same digit
+        if( count[ traits::digit( src[0], pass ) ] == n ) continue ;
+
+        int total = 0 ;
+        for( int d=0; d<256; d++){
+            int c = count[d] ;
+            count[d] = total ;
+            total += c ;
+        }
+        for( int i=0; i<n; i++){
+            int pos = count[ traits::digit( src[i], pass ) ]++ ;
+            dest[pos] = src[i] ;
+            if( index ) dest_index[pos] = src_index[i] ;
+        }
+        std::swap( src, dest ) ;
+        std::swap( src_index, dest_index ) ;
+    }
+
+    if( src != keys ){
+        std::copy( src, src + n, keys ) ;
+        if( index ) std::copy( src_index, src_index + n, index ) ;
+    }
+}
+
+template <typename T>
+class radix_index_comparator {
+public:
+    radix_index_comparator( const T* x_ ) : x(x_){}
+
+    inline bool operator()( int i, int j ) const {
+        return NAComparator<T>()( x[i], x[j] ) ;
+    }
+
+private:
+    const T* x ;
+} ;
+
+/**
+ * Sorts [first,last) in the order given by NAComparator
+ */
+template <typename T>
+inline void radix_sort( T* first, T* last ){
+    std::sort( first, last, NAComparator<T>() ) ;
+}
+
+template <typename T>
+inline void radix_sort_values( T* first, T* last ){
+    int n = static_cast<int>( last - first ) ;
+    if( n < RCPP_RADIX_SORT_MIN_SIZE ){
+        std::sort( first, last, NAComparator<T>() ) ;
+        return ;
+    }
+    typedef typename radix_key_type<T>::type KEY ;
+    std::vector<KEY> keys( n ) ;
+    for( int i=0; i<n; i++) keys[i] = radix_key( first[i] ) ;
+    radix_sort_keys<KEY>( &keys[0], 0, n ) ;
+    for( int i=0; i<n; i++) first[i] = radix_value( keys[i] ) ;
+}
+
+inline void radix_sort( int* first, int* last ){
+    radix_sort_values( first, last ) ;
+}
+
+inline void radix_sort( double* first, double* last ){
+    radix_sort_values( first, last ) ;
+}
+
+/**
+ * Fills index with the stable permutation (0-based) that sorts the n
+ * values of x
+ */
+template <typename T>
+inline void radix_order( const T* x, int n, int* index ){
+    for( int i=0; i<n; i++) index[i] = i ;
+    std::stable_sort( index, index + n, radix_index_comparator<T>( x ) ) ;
+}
+
+template <typename T>
+inline void radix_order_values( const T* x, int n, int* index ){
+    if( n < RCPP_RADIX_SORT_MIN_SIZE ){
+        radix_order<T>( x, n, index ) ;
+        return ;
+    }
+    typedef typename radix_key_type<T>::type KEY ;
+    std::vector<KEY> keys( n ) ;
+    for( int i=0; i<n; i++){
+        // -0.0 and 0.0 are equal, so they must keep their relative order
+        keys[i] = radix_key( x[i] == 0 ? T(0) : x[i] ) ;
+        index[i] = i ;
+    }
+    radix_sort_keys<KEY>( &keys[0], index, n ) ;
+}
+
+inline void radix_order( const int* x, int n, int* index ){
+    radix_order_values( x, n, index ) ;
+}
+
+inline void radix_order( const double* x, int n, int* index ){
+    radix_order_values( x, n, index ) ;
+}
+
+// orders (CHARSXP, rank) pairs by pointer: the built-in < on unrelated
+// pointers is unspecified, std::less gives a total order
+struct radix_pointer_less {
+    inline bool operator()( const std::pair<SEXP,unsigned int>& a,
+                            const std::pair<SEXP,unsigned int>& b ) const {
+        return std::less<SEXP>()( a.first, b.first ) ;
+    }
+} ;
+
+/*
+ * Strings are first grouped by CHARSXP pointer (equal strings share the
+ * same CHARSXP in R's cache), the distinct strings are sorted once, and
+ * the elements are then radix sorted by the rank of their string.
+ */
+inline void radix_string_ranks( const SEXP* x, int n, unsigned int* ranks ){
+    std::vector<SEXP> levels( x, x + n ) ;
+    std::sort( levels.begin(), levels.end(), std::less<SEXP>() ) ;
+    levels.erase( std::unique( levels.begin(), levels.end() ), levels.end() ) ;
+    std::sort( levels.begin(), levels.end(), NAComparator<SEXP>() ) ;
+
+    // CHARSXPs that differ only by encoding compare equal and share a rank
+    int nlevels = levels.size() ;
+    std::vector< std::pair<SEXP,unsigned int> > by_pointer( nlevels ) ;
+    unsigned int rank = 0 ;
+    for( int j=0; j<nlevels; j++){
+        if( j > 0 && StrCmp( levels[j-1], levels[j] ) != 0 ) rank++ ;
+        by_pointer[j] = std::make_pair( levels[j], rank ) ;
+    }
+    std::sort( by_pointer.begin(), by_pointer.end(), radix_pointer_less() ) ;
+
+    for( int i=0; i<n; i++){
+        ranks[i] = std::lower_bound( by_pointer.begin(), by_pointer.end(),
+            std::make_pair( x[i], 0u ), radix_pointer_less() )->second ;
+    }
+}
+
+inline void radix_order( const SEXP* x, int n, int* index ){
+    if( n < RCPP_RADIX_SORT_MIN_SIZE ){
+        radix_order<SEXP>( x, n, index ) ;
+        return ;
+    }
+    std::vector<unsigned int> ranks( n ) ;
+    radix_string_ranks( x, n, &ranks[0] ) ;
+    for( int i=0; i<n; i++) index[i] = i ;
+    radix_sort_keys<unsigned int>( &ranks[0], index, n ) ;
+}
+
+inline void radix_sort( SEXP* first, SEXP* last ){
+    int n = static_cast<int>( last - first ) ;
+    if( n < RCPP_RADIX_SORT_MIN_SIZE ){
+        std::sort( first, last, NAComparator<SEXP>() ) ;
+        return ;
+    }
+    std::vector<int> index( n ) ;
+    radix_order( first, n, &index[0] ) ;
+    std::vector<SEXP> sorted( n ) ;
+    for( int i=0; i<n; i++) sorted[i] = first[ index[i] ] ;
+    std::copy( sorted.begin(), sorted.end(), first ) ;
+}
+
+} // internal
+} // Rcpp
+
+#endif
@@ -2,7 +2,7 @@
 //
 // Rstreambuf.h: Rcpp R/C++ interface class library -- stream buffer
 //
-// Copyright (C) 2011 - 2013    Dirk Eddelbuettel, Romain Francois and Jelmer Ypma
+// Copyright (C) 2011 - 2014    Dirk Eddelbuettel, Romain Francois and Jelmer Ypma
 //
 // This file is part of Rcpp.
 //
@@ -23,14 +23,58 @@
 #define RCPP__IOSTREAM__RSTREAMBUF_H
 
 #include <cstdio>
+#include <cstring>
 #include <streambuf>
 
+// size of the buffer of Rcout and Rcerr, when buffering is turned on
+#ifndef RCPP_OSTREAM_BUFFER_SIZE
+#define RCPP_OSTREAM_BUFFER_SIZE 1024
+#endif
+
 namespace Rcpp {
 
+    /**
+     * Stream buffer sending the characters given to Rcout/Rcerr to R's
+     * console. By default each insertion is written right away, so that
+     * the output stays in order with plain Rprintf calls. Once
+     * set_buffered(true) is called, characters are collected and written
+     * in a single call to Rprintf/REprintf when the buffer is full, on
+     * sync (std::flush and std::endl) and when buffering is turned off.
+     * Writes larger than the buffer go directly to the console.
+     */
     template <bool OUTPUT>
     class Rstreambuf : public std::streambuf {
     public:
-        Rstreambuf(){}
+        Rstreambuf() : buffer(), buffered(false) {}
+
+        /**
+         * turns buffering on or off, what is pending is written when it
+         * is turned off
+         */
+        void set_buffered( bool value ){
+            if( value == buffered ) return ;
+            if( value ){
+                buffer.resize( RCPP_OSTREAM_BUFFER_SIZE > 0 ? RCPP_OSTREAM_BUFFER_SIZE : 1 ) ;
+                setp( &buffer[0], &buffer[0] + buffer.size() ) ;
+            } else {
+                flush_buffer() ;
+                setp( 0, 0 ) ;
+            }
+            buffered = value ;
+        }
+
+        inline bool is_buffered() const { return buffered ; }
+
+        /**
+         * writes the pending characters, without flushing the console
+         */
+        inline void flush_buffer(){
+            std::streamsize n = pptr() - pbase() ;
+            if( n > 0 ){
+                write( pbase(), n ) ;
+                setp( pbase(), epptr() ) ;
+            }
+        }
 
     protected:
         virtual std::streamsize xsputn(const char *s, std::streamsize n );
@@ -38,54 +82,203 @@ namespace Rcpp {
         virtual int overflow(int c = EOF );
 
         virtual int sync()  ;
+
+    private:
+        std::vector<char> buffer ;
+        bool buffered ;
+
+        void write( const char* s, std::streamsize n ) ;
     };
 
+    namespace internal {
+
+        /**
+         * The buffer shared by the Rcout (or Rcerr) of all the files of a
+         * package, so that output from different files stays in order. It
+         * is never destroyed: nothing is written to R while the library is
+         * unloaded.
+         */
+        template <bool OUTPUT>
+        inline Rstreambuf<OUTPUT>* shared_Rstreambuf(){
+            static Rstreambuf<OUTPUT>* buf = new Rstreambuf<OUTPUT> ;
+            return buf ;
+        }
+
+    }
+
     template <bool OUTPUT>
     class Rostream : public std::ostream {
         typedef Rstreambuf<OUTPUT> Buffer ;
         Buffer* buf ;
     public:
         Rostream() :
-            std::ostream( new Buffer ),
-            buf( static_cast<Buffer*>( rdbuf() ) )
+            std::ostream( internal::shared_Rstreambuf<OUTPUT>() ),
+            buf( internal::shared_Rstreambuf<OUTPUT>() )
         {}
-        ~Rostream() {
-            if (buf != NULL) {
-                delete buf;
-                buf = NULL;
-            }
-        }
+
+        /**
+         * Collect the output until the buffer is full, std::flush or
+         * std::endl, instead of writing each insertion. Output that must
+         * reach the console before control goes back to R has to be
+         * flushed, e.g. by turning buffering off again. RostreamBuffering
+         * does this when leaving a scope, also on exceptions.
+         */
+        inline void set_buffered( bool value ){ buf->set_buffered( value ) ; }
+
+        inline bool is_buffered() const { return buf->is_buffered() ; }
+
+        /**
+         * writes what is pending in the buffer, this is cheaper than
+         * flush() which also flushes R's console
+         */
+        inline void flush_buffer(){ buf->flush_buffer() ; }
     };
 
-    template <> inline std::streamsize Rstreambuf<true>::xsputn(const char *s, std::streamsize num ) {
-        Rprintf( "%.*s", num, s ) ;
-        return num ;
+    /**
+     * Turns buffering of Rcout (or Rcerr) on for its lifetime. When it is
+     * destroyed, including by an exception or an early return, what is
+     * pending is written and the previous mode is restored, so that no
+     * output is held back once control goes back to R:
+     *
+     *     RostreamBuffering buffering( Rcout ) ;
+     *     for( int i=0; i<n; i++) Rcout << i << "\n" ;
+     */
+    class RostreamBuffering {
+    public:
+        template <bool OUTPUT>
+        RostreamBuffering( Rostream<OUTPUT>& stream ) :
+            restore( &restore__impl<OUTPUT> ), previous( stream.is_buffered() )
+        {
+            stream.set_buffered( true ) ;
+        }
+
+        ~RostreamBuffering(){
+            restore( previous ) ;
+        }
+
+    private:
+        void (*restore)( bool ) ;
+        bool previous ;
+
+        template <bool OUTPUT>
+        static void restore__impl( bool value ){
+            Rstreambuf<OUTPUT>* buf = internal::shared_Rstreambuf<OUTPUT>() ;
+            buf->flush_buffer() ;
+            buf->set_buffered( value ) ;
+        }
+
+        // not copyable
+        RostreamBuffering( const RostreamBuffering& ) ;
+        RostreamBuffering& operator=( const RostreamBuffering& ) ;
+    } ;
+
+    template <> inline void Rstreambuf<true>::write(const char *s, std::streamsize num ) {
+        Rprintf( "%.*s", static_cast<int>(num), s ) ;
     }
-    template <> inline std::streamsize Rstreambuf<false>::xsputn(const char *s, std::streamsize num ) {
-        REprintf( "%.*s", num, s ) ;
-        return num ;
+    template <> inline void Rstreambuf<false>::write(const char *s, std::streamsize num ) {
+        REprintf( "%.*s", static_cast<int>(num), s ) ;
     }
 
-    template <> inline int Rstreambuf<true>::overflow(int c ) {
-      if (c != EOF) Rprintf( "%.1s", &c ) ;
-      return c ;
-    }
-    template <> inline int Rstreambuf<false>::overflow(int c ) {
-      if (c != EOF) REprintf( "%.1s", &c ) ;
-      return c ;
+    template <bool OUTPUT>
+    inline std::streamsize Rstreambuf<OUTPUT>::xsputn(const char *s, std::streamsize num ) {
+        if( num <= 0 ) return 0 ;
+        if( num > epptr() - pptr() ){
+            flush_buffer() ;
+            if( num >= epptr() - pptr() ){
+                write( s, num ) ;
+                return num ;
+            }
+        }
+        std::memcpy( pptr(), s, num ) ;
+        pbump( static_cast<int>(num) ) ;
+        return num ;
     }
 
-    template <> inline int Rstreambuf<true>::sync(){
-        ::R_FlushConsole() ;
-        return 0 ;
+    // called for each character when not buffered, and when the buffer is full
+    template <bool OUTPUT>
+    inline int Rstreambuf<OUTPUT>::overflow(int c ) {
+        flush_buffer() ;
+        if (c != EOF){
+            char ch = traits_type::to_char_type( c ) ;
+            if( pptr() != epptr() ){
+                *pptr() = ch ;
+                pbump( 1 ) ;
+            } else {
+                write( &ch, 1 ) ;
+            }
+        }
+        return traits_type::not_eof( c ) ;
     }
-    template <> inline int Rstreambuf<false>::sync(){
+
+    template <bool OUTPUT>
+    inline int Rstreambuf<OUTPUT>::sync(){
+        flush_buffer() ;
         ::R_FlushConsole() ;
         return 0 ;
     }
+
     static Rostream<true>  Rcout;
     static Rostream<false> Rcerr;
 
+    /**
+     * Collects the output of several threads, one buffer per thread, so
+     * that it can be written to Rcout or Rcerr afterwards by the main
+     * thread. Rcout and Rcerr themselves must only be used from the main
+     * thread, since they call into R.
+     *
+     *     RostreamCollector out( omp_get_max_threads() ) ;
+     *     #pragma omp parallel for
+     *     for( int i=0; i<n; i++){
+     *         out[ omp_get_thread_num() ] << "item " << i << std::endl ;
+     *     }
+     *     out.flush( Rcout ) ;
+     *
+     * Each thread must only write to its own buffer.
+     */
+    class RostreamCollector {
+    public:
+        RostreamCollector( int nthreads = 1 ) : streams( nthreads > 0 ? nthreads : 1 ){
+            for( std::size_t i=0; i<streams.size(); i++){
+                streams[i] = new std::ostringstream ;
+            }
+        }
+
+        ~RostreamCollector(){
+            for( std::size_t i=0; i<streams.size(); i++){
+                delete streams[i] ;
+            }
+        }
+
+        inline int size() const { return streams.size() ; }
+
+        /**
+         * the buffer of the given thread
+         */
+        inline std::ostream& operator[]( int thread ){
+            return *streams[thread] ;
+        }
+
+        /**
+         * writes the content of the buffers to target, in thread order,
+         * and empties them. Must be called from the main thread.
+         */
+        void flush( std::ostream& target ){
+            for( std::size_t i=0; i<streams.size(); i++){
+                std::string content = streams[i]->str() ;
+                if( content.empty() ) continue ;
+                target.write( content.data(), content.size() ) ;
+                streams[i]->str( std::string() ) ;
+            }
+            target.flush() ;
+        }
+
+    private:
+        std::vector<std::ostringstream*> streams ;
+
+        // not copyable
+        RostreamCollector( const RostreamCollector& ) ;
+        RostreamCollector& operator=( const RostreamCollector& ) ;
+    } ;
 
 }
 
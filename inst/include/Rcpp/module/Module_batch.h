@@ -0,0 +1,192 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// Module_batch.h: Rcpp R/C++ interface class library -- calling a method on many objects
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_Module_batch_h
+#define Rcpp_Module_batch_h
+
+// helpers of class_<Class>::invoke_batch
+
+namespace internal {
+
+    inline bool batch_is_scalar( SEXP x ){
+        if( Rf_length(x) != 1 || ATTRIB(x) != R_NilValue ) return false ;
+        switch( TYPEOF(x) ){
+        case LGLSXP:
+        case INTSXP:
+        case REALSXP:
+        case CPLXSXP:
+        case STRSXP:
+        case RAWSXP:
+            return true ;
+        default:
+            return false ;
+        }
+    }
+
+    // to[j] = from[i], both of the same type
+    inline void batch_copy_element( SEXP from, int i, SEXP to, int j ){
+        switch( TYPEOF(from) ){
+        case LGLSXP:  LOGICAL(to)[j] = LOGICAL(from)[i] ; break ;
+        case INTSXP:  INTEGER(to)[j] = INTEGER(from)[i] ; break ;
+        case REALSXP: REAL(to)[j] = REAL(from)[i] ; break ;
+        case CPLXSXP: COMPLEX(to)[j] = COMPLEX(from)[i] ; break ;
+        case RAWSXP:  RAW(to)[j] = RAW(from)[i] ; break ;
+        case STRSXP:  SET_STRING_ELT( to, j, STRING_ELT(from, i) ) ; break ;
+        case VECSXP:  SET_VECTOR_ELT( to, j, VECTOR_ELT(from, i) ) ; break ;
+        default:
+            throw std::range_error( "cannot take elements of this type" ) ;
+        }
+    }
+
+    /**
+     * The external pointer of an object given to invoke_batch, a C++
+     * object created by new(), whose environment has the pointer to the
+     * object as .pointer and the pointer to its class as .cppclass. The
+     * class is checked. Bare external pointers are not accepted, as
+     * nothing tells the class of the object they point to.
+     */
+    inline SEXP batch_object_pointer( SEXP object, class_Base* clazz ){
+        SEXP env = object ;
+        if( TYPEOF(env) == S4SXP ) env = R_do_slot( object, Rf_install( ".xData" ) ) ;
+        if( TYPEOF(env) != ENVSXP )
+            throw not_compatible( "expecting a C++ object or an external pointer" ) ;
+        SEXP cppclass = Rf_findVarInFrame( env, Rf_install( ".cppclass" ) ) ;
+        if( TYPEOF(cppclass) != EXTPTRSXP || R_ExternalPtrAddr(cppclass) != static_cast<void*>(clazz) )
+            throw not_compatible( "all objects must be of the class of the method" ) ;
+        return Rf_findVarInFrame( env, Rf_install( ".pointer" ) ) ;
+    }
+
+    /**
+     * The arguments of the i-th call of invoke_batch. Each argument is
+     * given as a vector or list with one element per object, or with a
+     * single element used for all the objects. Elements of lists are
+     * given as they are. Elements of atomic vectors are copied into a new
+     * length one vector for each call, so they lose their attributes.
+     */
+    class BatchArguments {
+    public:
+        BatchArguments( SEXP args_, int n ) :
+            args(args_), nargs( Rf_length(args_) ),
+            per_object( nargs ), buffers( nargs ), values( nargs )
+        {
+            for( int j=0; j<nargs; j++){
+                SEXP arg = VECTOR_ELT( args, j ) ;
+                switch( TYPEOF(arg) ){
+                case LGLSXP:
+                case INTSXP:
+                case REALSXP:
+                case CPLXSXP:
+                case STRSXP:
+                case RAWSXP:
+                case VECSXP:
+                    break ;
+                default:
+                    throw not_compatible( "arguments must be vectors or lists" ) ;
+                }
+                int len = Rf_length(arg) ;
+                if( len == n ){
+                    per_object[j] = true ;
+                } else if( len == 1 ){
+                    per_object[j] = false ;
+                    values[j] = TYPEOF(arg) == VECSXP ? VECTOR_ELT( arg, 0 ) : arg ;
+                } else {
+                    throw std::range_error( "arguments must have one element or one per object" ) ;
+                }
+            }
+        }
+
+        SEXP* get( int i ){
+            for( int j=0; j<nargs; j++){
+                if( !per_object[j] ) continue ;
+                SEXP arg = VECTOR_ELT( args, j ) ;
+                if( TYPEOF(arg) == VECSXP ){
+                    values[j] = VECTOR_ELT( arg, i ) ;
+                } else {
+                    // a new vector each time: the method may keep it or
+                    // return it
+                    SEXP value = Rf_allocVector( TYPEOF(arg), 1 ) ;
+                    SET_VECTOR_ELT( buffers, j, value ) ;
+                    batch_copy_element( arg, i, value, 0 ) ;
+                    values[j] = value ;
+                }
+            }
+            return nargs ? &values[0] : 0 ;
+        }
+
+        inline int size() const { return nargs ; }
+
+    private:
+        SEXP args ;
+        int nargs ;
+        std::vector<bool> per_object ;
+        // protects the values of the current call
+        Rcpp::List buffers ;
+        std::vector<SEXP> values ;
+    } ;
+
+    /**
+     * Results of invoke_batch, collected in an atomic vector as long as
+     * the method gives scalars of the same type, and in a list otherwise.
+     */
+    class BatchResults {
+    public:
+        BatchResults( int n_ ) : n(n_), out(), atomic(false) {}
+
+        // x must be protected
+        void set( int i, SEXP x ){
+            if( i == 0 ){
+                atomic = batch_is_scalar(x) ;
+                out = Rf_allocVector( atomic ? TYPEOF(x) : VECSXP, n ) ;
+            }
+            if( atomic ){
+                if( batch_is_scalar(x) && TYPEOF(x) == TYPEOF(out) ){
+                    batch_copy_element( x, 0, out, i ) ;
+                    return ;
+                }
+                to_list( i ) ;
+            }
+            SET_VECTOR_ELT( out, i, x ) ;
+        }
+
+        inline SEXP get() const { return out ; }
+
+    private:
+
+        // the first i results, so far in an atomic vector, move to a list
+        void to_list( int i ){
+            Shield<SEXP> list( Rf_allocVector( VECSXP, n ) ) ;
+            for( int k=0; k<i; k++){
+                SEXP elt = Rf_allocVector( TYPEOF(out), 1 ) ;
+                SET_VECTOR_ELT( list, k, elt ) ;
+                batch_copy_element( out, k, elt, 0 ) ;
+            }
+            out = list ;
+            atomic = false ;
+        }
+
+        int n ;
+        Rcpp::RObject out ;
+        bool atomic ;
+    } ;
+
+}
+
+#endif
@@ -0,0 +1,51 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// Module_variadic_Constructor.h: Rcpp R/C++ interface class library -- Rcpp modules, variadic version of Module_generated_Constructor.h
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_Module_variadic_Constructor_h
+#define Rcpp_Module_variadic_Constructor_h
+
+template <typename Class>
+class Constructor_Base {
+public:
+    virtual Class* get_new( SEXP* args, int nargs ) = 0 ;
+    virtual int nargs() = 0 ;
+    virtual void signature(std::string& s, const std::string& class_name) = 0 ;
+} ;
+
+template <typename Class, typename... U>
+class ConstructorN : public Constructor_Base<Class>{
+public:
+    virtual Class* get_new( SEXP* args, int nargs ){
+        return get_new( args, internal::make_index_sequence<sizeof...(U)>() ) ;
+    }
+    virtual int nargs(){ return sizeof...(U) ; }
+    virtual void signature(std::string& s, const std::string& class_name ){
+        ctor_signature<U...>(s, class_name) ;
+    }
+
+private:
+    template <int... I>
+    inline Class* get_new( SEXP* args, internal::index_sequence<I...> ){
+        return new Class( as<U>(args[I])... ) ;
+    }
+} ;
+
+#endif
@@ -0,0 +1,94 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// Module_variadic_CppFunction.h: Rcpp R/C++ interface class library -- Rcpp modules, variadic version of Module_generated_CppFunction.h
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_Module_variadic_CppFunction_h
+#define Rcpp_Module_variadic_CppFunction_h
+
+namespace Rcpp{
+
+namespace internal {
+
+    // calls fun with arguments converted to U...
+    // through void (*)(void), which converts to and from any function
+    // pointer type without -Wcast-function-type warnings
+    template <typename OUT, typename... U>
+    inline DL_FUNC function_ptr( OUT (*fun)(U...) ){
+        return reinterpret_cast<DL_FUNC>( reinterpret_cast<void (*)(void)>( fun ) ) ;
+    }
+
+    template <typename OUT, typename... U, int... I>
+    inline SEXP call_function( OUT (*fun)(U...), SEXP* args, index_sequence<I...> ){
+        input_parameters<U...> params( args ) ;
+        return module_result<OUT>::get( [&]() -> OUT { return fun( input_parameter_at<I>::get(params)... ) ; } ) ;
+    }
+
+}
+
+template <typename OUT, typename... U>
+class CppFunctionN : public CppFunction {
+    public:
+        CppFunctionN(OUT (*fun)(U...), const char* docstring = 0 ) : CppFunction(docstring), ptr_fun(fun){}
+
+        SEXP operator()(SEXP* args) {
+            BEGIN_RCPP
+            return internal::call_function<OUT,U...>( ptr_fun, args, internal::make_index_sequence<sizeof...(U)>() ) ;
+            END_RCPP
+        }
+
+        inline int nargs(){ return sizeof...(U) ; }
+        inline bool is_void(){ return traits::same_type<OUT,void>::value ; }
+        inline void signature(std::string& s, const char* name){
+            Rcpp::signature<typename internal::signature_type<OUT>::type, U...>(s, name) ;
+        }
+        inline DL_FUNC get_function_ptr(){ return internal::function_ptr( ptr_fun ) ; }
+
+    private:
+        OUT (*ptr_fun)(U...) ;
+} ;
+
+template <typename OUT, typename... U>
+class CppFunction_WithFormalsN : public CppFunction {
+    public:
+        CppFunction_WithFormalsN(OUT (*fun)(U...), Rcpp::List formals_, const char* docstring = 0 ) :
+            CppFunction(docstring), formals(formals_), ptr_fun(fun){}
+
+        SEXP operator()(SEXP* args) {
+            BEGIN_RCPP
+            return internal::call_function<OUT,U...>( ptr_fun, args, internal::make_index_sequence<sizeof...(U)>() ) ;
+            END_RCPP
+        }
+
+        inline int nargs(){ return sizeof...(U) ; }
+        inline bool is_void(){ return traits::same_type<OUT,void>::value ; }
+        inline void signature(std::string& s, const char* name){
+            Rcpp::signature<typename internal::signature_type<OUT>::type, U...>(s, name) ;
+        }
+        SEXP get_formals(){ return formals; }
+        inline DL_FUNC get_function_ptr(){ return internal::function_ptr( ptr_fun ) ; }
+
+    private:
+        Rcpp::List formals ;
+        OUT (*ptr_fun)(U...) ;
+} ;
+
+}
+
+#endif
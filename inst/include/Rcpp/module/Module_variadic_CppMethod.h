@@ -0,0 +1,130 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// Module_variadic_CppMethod.h: Rcpp R/C++ interface class library -- Rcpp modules, variadic version of Module_generated_CppMethod.h and Module_generated_Pointer_CppMethod.h
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_Module_variadic_CppMethod_h
+#define Rcpp_Module_variadic_CppMethod_h
+
+	namespace internal {
+
+		template <typename Class, typename OUT, typename... U, typename... X>
+		inline OUT invoke_method( OUT (Class::*m)(U...), Class* object, X&... x ){ return (object->*m)( x... ) ; }
+		template <typename Class, typename OUT, typename... U, typename... X>
+		inline OUT invoke_method( OUT (Class::*m)(U...) const, Class* object, X&... x ){ return (object->*m)( x... ) ; }
+		template <typename Class, typename OUT, typename... U, typename... X>
+		inline OUT invoke_method( OUT (*m)(Class*, U...), Class* object, X&... x ){ return m( object, x... ) ; }
+		template <typename Class, typename OUT, typename... U, typename... X>
+		inline OUT invoke_method( OUT (*m)(const Class*, U...), Class* object, X&... x ){ return m( object, x... ) ; }
+
+		// calls the method m of object, a pointer to a member function or to
+		// a function taking the object first, with arguments converted to U...
+		// and the result wrapped as WRAP
+		template <typename OUT, typename WRAP, typename... U, typename Class, typename METHOD, int... I>
+		inline SEXP call_method( METHOD m, Class* object, SEXP* args, index_sequence<I...> ){
+			input_parameters<U...> params( args ) ;
+			return module_result<OUT,WRAP>::get( [&]() -> OUT { return invoke_method( m, object, input_parameter_at<I>::get(params)... ) ; } ) ;
+		}
+
+		// as in Module_generated_Pointer_CppMethod.h, results of functions
+		// without arguments are wrapped as OUT rather than as the cleaned type
+		template <typename OUT, int N>
+		struct pointer_method_wrap {
+			typedef typename traits::if_< N == 0, OUT, typename traits::remove_const_and_reference<OUT>::type >::type type ;
+		} ;
+
+	}
+
+	template <typename Class, typename OUT, typename... U> class CppMethodN : public CppMethod<Class> {
+	public:
+		typedef OUT (Class::*Method)(U...) ;
+		typedef CppMethod<Class> method_class ;
+		typedef typename Rcpp::traits::remove_const_and_reference< OUT >::type CLEANED_OUT ;
+
+		CppMethodN( Method m) : method_class(), met(m){}
+		SEXP operator()( Class* object, SEXP* args){
+			return internal::call_method<OUT,CLEANED_OUT,U...>( met, object, args, internal::make_index_sequence<sizeof...(U)>() ) ;
+		}
+		inline int nargs(){ return sizeof...(U) ; }
+		inline bool is_void(){ return traits::same_type<OUT,void>::value ; }
+		inline bool is_const(){ return false ; }
+		inline void signature(std::string& s, const char* name){ Rcpp::signature<typename internal::signature_type<OUT>::type, U...>(s, name) ; }
+
+	private:
+		Method met ;
+	} ;
+
+	template <typename Class, typename OUT, typename... U> class const_CppMethodN : public CppMethod<Class> {
+	public:
+		typedef OUT (Class::*Method)(U...) const ;
+		typedef CppMethod<Class> method_class ;
+		typedef typename Rcpp::traits::remove_const_and_reference< OUT >::type CLEANED_OUT ;
+
+		const_CppMethodN( Method m) : method_class(), met(m){}
+		SEXP operator()( Class* object, SEXP* args){
+			return internal::call_method<OUT,CLEANED_OUT,U...>( met, object, args, internal::make_index_sequence<sizeof...(U)>() ) ;
+		}
+		inline int nargs(){ return sizeof...(U) ; }
+		inline bool is_void(){ return traits::same_type<OUT,void>::value ; }
+		inline bool is_const(){ return true ; }
+		inline void signature(std::string& s, const char* name){ Rcpp::signature<typename internal::signature_type<OUT>::type, U...>(s, name) ; }
+
+	private:
+		Method met ;
+	} ;
+
+	template <typename Class, typename OUT, typename... U> class Pointer_CppMethodN : public CppMethod<Class> {
+	public:
+		typedef OUT (*Method)(Class*, U...) ;
+		typedef CppMethod<Class> method_class ;
+		typedef typename internal::pointer_method_wrap< OUT, sizeof...(U) >::type CLEANED_OUT ;
+
+		Pointer_CppMethodN( Method m) : method_class(), met(m){}
+		SEXP operator()( Class* object, SEXP* args){
+			return internal::call_method<OUT,CLEANED_OUT,U...>( met, object, args, internal::make_index_sequence<sizeof...(U)>() ) ;
+		}
+		inline int nargs(){ return sizeof...(U) ; }
+		inline bool is_void(){ return traits::same_type<OUT,void>::value ; }
+		inline bool is_const(){ return false ; }
+		inline void signature(std::string& s, const char* name){ Rcpp::signature<typename internal::signature_type<OUT>::type, U...>(s, name) ; }
+
+	private:
+		Method met ;
+	} ;
+
+	template <typename Class, typename OUT, typename... U> class Const_Pointer_CppMethodN : public CppMethod<Class> {
+	public:
+		typedef OUT (*Method)(const Class*, U...) ;
+		typedef CppMethod<Class> method_class ;
+		typedef typename internal::pointer_method_wrap< OUT, sizeof...(U) >::type CLEANED_OUT ;
+
+		Const_Pointer_CppMethodN( Method m) : method_class(), met(m){}
+		SEXP operator()( Class* object, SEXP* args){
+			return internal::call_method<OUT,CLEANED_OUT,U...>( met, object, args, internal::make_index_sequence<sizeof...(U)>() ) ;
+		}
+		inline int nargs(){ return sizeof...(U) ; }
+		inline bool is_void(){ return traits::same_type<OUT,void>::value ; }
+		inline bool is_const(){ return true ; }
+		inline void signature(std::string& s, const char* name){ Rcpp::signature<typename internal::signature_type<OUT>::type, U...>(s, name) ; }
+
+	private:
+		Method met ;
+	} ;
+
+#endif
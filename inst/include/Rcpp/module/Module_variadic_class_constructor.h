@@ -0,0 +1,31 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// Module_variadic_class_constructor.h: Rcpp R/C++ interface class library -- Rcpp modules, variadic version of Module_generated_class_constructor.h
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_Module_variadic_class_constructor_h
+#define Rcpp_Module_variadic_class_constructor_h
+
+    template <typename... U>
+    self& constructor( const char* docstring = 0, ValidConstructor valid = &yes_arity<sizeof...(U)> ){
+        AddConstructor( new ConstructorN<Class,U...> , valid, docstring ) ;
+        return *this ;
+    }
+
+#endif
@@ -0,0 +1,126 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// Module_variadic_get_signature.h: Rcpp R/C++ interface class library -- Rcpp modules, variadic version of Module_generated_get_signature.h
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_Module_variadic_get_signature_h
+#define Rcpp_Module_variadic_get_signature_h
+
+namespace Rcpp {
+
+namespace internal {
+
+    template <int... I> struct index_sequence {} ;
+
+    // make_index_sequence<N> derives from index_sequence<0, ..., N-1>
+    template <int N, int... I> struct make_index_sequence : make_index_sequence<N - 1, N - 1, I...> {} ;
+    template <int... I> struct make_index_sequence<0, I...> : index_sequence<I...> {} ;
+
+    // appends the types U..., separated by commas
+    template <typename... U> struct signature_types ;
+
+    template <> struct signature_types<> {
+        static inline void append( std::string& ){}
+    } ;
+
+    template <typename U0, typename... U> struct signature_types<U0, U...> {
+        static inline void append( std::string& s ){
+            s += get_return_type<U0>() ;
+            if( sizeof...(U) > 0 ) s += ", " ;
+            signature_types<U...>::append( s ) ;
+        }
+    } ;
+
+    // the return type as shown in signatures
+    template <typename OUT> struct signature_type { typedef OUT type ; } ;
+    template <> struct signature_type<void> { typedef void_type type ; } ;
+
+    // arguments of a function taking U..., converted from the R objects.
+    // Each argument is a member declared before the following ones, so the
+    // arguments converted on construction (references and const) are
+    // converted from first to last, as in the generated classes. The
+    // elements of a std::tuple are not constructed in order. Arguments
+    // passed by value are converted at the call, as in the generated classes.
+    template <typename... U> struct input_parameters ;
+
+    template <> struct input_parameters<> {
+        input_parameters( SEXP* ){}
+    } ;
+
+    template <typename U0, typename... U> struct input_parameters<U0, U...> {
+        input_parameters( SEXP* args ) : head( args[0] ), tail( args + 1 ){}
+        typename traits::input_parameter<U0>::type head ;
+        input_parameters<U...> tail ;
+    } ;
+
+    // argument I of input_parameters
+    template <int I> struct input_parameter_at {
+        template <typename PARAMS>
+        static inline auto get( PARAMS& params ) -> decltype( input_parameter_at<I - 1>::get( params.tail ) ){
+            return input_parameter_at<I - 1>::get( params.tail ) ;
+        }
+    } ;
+
+    template <> struct input_parameter_at<0> {
+        template <typename PARAMS>
+        static inline auto get( PARAMS& params ) -> decltype( ( params.head ) ){
+            return params.head ;
+        }
+    } ;
+
+    // calls CALL and wraps its result as a WRAP, or returns NULL when OUT is void
+    template <typename OUT, typename WRAP = OUT>
+    struct module_result {
+        template <typename CALL>
+        static inline SEXP get( CALL call ){ return Rcpp::module_wrap<WRAP>( call() ) ; }
+    } ;
+
+    template <typename WRAP>
+    struct module_result<void, WRAP> {
+        template <typename CALL>
+        static inline SEXP get( CALL call ){
+            call() ;
+            return R_NilValue ;
+        }
+    } ;
+
+}
+
+template <typename OUT, typename... U>
+inline void signature(std::string& s, const char* name){
+    s.clear() ;
+    s += get_return_type<OUT>() ;
+    s += " " ;
+    s += name ;
+    s += "(" ;
+    internal::signature_types<U...>::append( s ) ;
+    s += ")" ;
+}
+
+template <typename... U>
+inline void ctor_signature( std::string& s, const std::string& classname ){
+    s.assign(classname) ;
+    s += "(" ;
+    internal::signature_types<U...>::append( s ) ;
+    s += ")" ;
+}
+
+}
+
+#endif
@@ -0,0 +1,61 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// Module_variadic_method.h: Rcpp R/C++ interface class library -- Rcpp modules, variadic version of Module_generated_method.h and Module_generated_Pointer_method.h
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_Module_variadic_method_h
+#define Rcpp_Module_variadic_method_h
+
+	// methods without arguments accept any number of arguments, as in
+	// Module_generated_method.h
+	#define RCPP_DEFAULT_VALID_METHOD ( sizeof...(U) == 0 ? &yes : &yes_arity<sizeof...(U)> )
+
+	template <typename OUT, typename... U>
+	self& method( const char* name_, OUT (Class::*fun)(U... u), const char* docstring = 0, ValidMethod valid = RCPP_DEFAULT_VALID_METHOD ){
+		AddMethod( name_, new CppMethodN<Class,OUT,U...>( fun ), valid, docstring) ;
+  		return *this ;
+	}
+
+	template <typename OUT, typename... U>
+	self& method( const char* name_, OUT (Class::*fun)(U... u) const, const char* docstring = 0, ValidMethod valid = RCPP_DEFAULT_VALID_METHOD ){
+		AddMethod( name_, new const_CppMethodN<Class,OUT,U...>( fun ), valid, docstring ) ;
+  		return *this ;
+	}
+
+	template <typename OUT, typename... U>
+	self& nonconst_method( const char* name_, OUT (Class::*fun)(U... u), const char* docstring = 0, ValidMethod valid = RCPP_DEFAULT_VALID_METHOD ){
+		AddMethod( name_, new CppMethodN<Class,OUT,U...>( fun ), valid, docstring ) ;
+  		return *this ;
+	}
+
+	template <typename OUT, typename... U>
+	self& const_method( const char* name_, OUT (Class::*fun)(U... u) const, const char* docstring = 0, ValidMethod valid = RCPP_DEFAULT_VALID_METHOD ){
+		AddMethod( name_, new const_CppMethodN<Class,OUT,U...>( fun ), valid, docstring ) ;
+  		return *this ;
+	}
+
+	template <typename OUT, typename... U>
+	self& method( const char* name_, OUT (*fun)(Class*, U... u), const char* docstring = 0, ValidMethod valid = RCPP_DEFAULT_VALID_METHOD ){
+		AddMethod( name_, new Pointer_CppMethodN<Class,OUT,U...>( fun ), valid, docstring ) ;
+  		return *this ;
+	}
+
+	#undef RCPP_DEFAULT_VALID_METHOD
+
+#endif
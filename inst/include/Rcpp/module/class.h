@@ -111,7 +111,11 @@
             return constructor( docstring, valid ) ;
         }
 
+#ifdef RCPP_VARIADIC_MODULES
+#include <Rcpp/module/Module_variadic_class_constructor.h>
+#else
 #include <Rcpp/module/Module_generated_class_constructor.h>
+#endif
 #include <Rcpp/module/Module_generated_class_factory.h>
 
     public:
@@ -182,12 +186,8 @@
             if( !ok ){
                 throw std::range_error( "could not find valid method" ) ;
             }
-            if( m->is_void() ){
-                m->operator()( XP(object), args );
-                return Rcpp::List::create( true ) ;
-            } else {
-                return Rcpp::List::create( false, m->operator()( XP(object), args ) ) ;
-            }
+            // void methods give R_NilValue, which the R side makes invisible
+            return m->operator()( object_pointer(object), args ) ;
             END_RCPP
                 }
 
@@ -209,7 +209,7 @@
             if( !ok ){
                 throw std::range_error( "could not find valid method" ) ;
             }
-            m->operator()( XP(object), args );
+            m->operator()( object_pointer(object), args );
             END_RCPP
                 }
 
@@ -231,11 +231,67 @@
             if( !ok ){
                 throw std::range_error( "could not find valid method" ) ;
             }
-            return m->operator()( XP(object), args ) ;
+            return m->operator()( object_pointer(object), args ) ;
             END_RCPP
                 }
 
 
+        /**
+         * Calls the method named name on each object of the list objects,
+         * C++ objects of this class created by new(). args is a list
+         * with, for each argument of the method, a vector with one element
+         * per object or a single value used for all objects.
+         *
+         * The overload is chosen once, with the arguments of the first
+         * object. Scalar results of the same type are collected in an
+         * atomic vector, other results in a list. Void methods give NULL.
+         */
+        SEXP invoke_batch( const std::string& name, SEXP objects, SEXP args ){
+            BEGIN_RCPP
+
+            typename map_vec_signed_method::iterator mets_it = vec_methods.find( name ) ;
+            if( mets_it == vec_methods.end() ){
+                throw std::range_error( "no such method" ) ;
+            }
+            if( TYPEOF(objects) != VECSXP || TYPEOF(args) != VECSXP ){
+                throw not_compatible( "expecting a list of objects and a list of arguments" ) ;
+            }
+            int n = Rf_length( objects ) ;
+            if( n == 0 ) return Rf_allocVector( VECSXP, 0 ) ;
+            internal::BatchArguments batch_args( args, n ) ;
+
+            vec_signed_method* mets = mets_it->second ;
+            typename vec_signed_method::iterator it = mets->begin() ;
+            int nmets = mets->size() ;
+            method_class* m = 0 ;
+            SEXP* first_args = batch_args.get( 0 ) ;
+            for( int i=0; i<nmets; i++, ++it ){
+                if( ( (*it)->valid )( first_args, batch_args.size() ) ){
+                    m = (*it)->method ;
+                    break ;
+                }
+            }
+            if( !m ){
+                throw std::range_error( "could not find valid method" ) ;
+            }
+
+            bool is_void = m->is_void() ;
+            internal::BatchResults results( n ) ;
+            InterruptPoller poller ;
+            for( int i=0; i<n; i++){
+                poller.check() ;
+                Class* object = object_pointer( internal::batch_object_pointer( VECTOR_ELT(objects, i), this ) ) ;
+                if( !object ){
+                    throw std::range_error( "object has been destroyed" ) ;
+                }
+                Shield<SEXP> res( m->operator()( object, batch_args.get( i ) ) ) ;
+                if( !is_void ) results.set( i, res ) ;
+            }
+            return is_void ? R_NilValue : results.get() ;
+
+            END_RCPP
+        }
+
         self& AddMethod( const char* name_, method_class* m, ValidMethod valid = &yes, const char* docstring = 0){
             RCPP_DEBUG_MODULE_1( "AddMethod( %s, method_class* m, ValidMethod valid = &yes, const char* docstring = 0", name_ )
             self* ptr = get_instance() ;
@@ -253,8 +309,12 @@
             return *this ;
         }
 
+#ifdef RCPP_VARIADIC_MODULES
+#include <Rcpp/module/Module_variadic_method.h>
+#else
 #include <Rcpp/module/Module_generated_method.h>
 #include <Rcpp/module/Module_generated_Pointer_method.h>
+#endif
 
         bool has_method( const std::string& m){
             return vec_methods.find(m) != vec_methods.end() ;
@@ -480,6 +540,14 @@
 
         class_( ) : class_Base(), vec_methods(), properties(), specials(0), constructors(), factories() {};
 
+        // the object of a method call. Unlike XP(object) this does not
+        // preserve the external pointer, which costs an allocation per call
+        inline Class* object_pointer( SEXP object ){
+            if( TYPEOF(object) != EXTPTRSXP )
+                throw ::Rcpp::not_compatible( "expecting an external pointer" ) ;
+            return reinterpret_cast< Class* >( R_ExternalPtrAddr( object ) ) ;
+        }
+
 
     public:
 
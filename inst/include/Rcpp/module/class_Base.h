@@ -56,6 +56,9 @@ public:
     virtual SEXP invoke_notvoid( SEXP, SEXP, SEXP *, int ){
         return R_NilValue ;
     }
+    virtual SEXP invoke_batch( const std::string&, SEXP, SEXP ){
+        return R_NilValue ;
+    }
 
     virtual Rcpp::CharacterVector method_names(){ return Rcpp::CharacterVector(0) ; }
     virtual Rcpp::CharacterVector property_names(){ return Rcpp::CharacterVector(0) ; }
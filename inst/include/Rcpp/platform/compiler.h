@@ -73,7 +73,7 @@
     #if __cplusplus >= 201103L
         #define HAS_CXX0X_FLAG
         #if __has_feature(cxx_variadic_templates)
-            // #define HAS_VARIADIC_TEMPLATES
+            #define HAS_VARIADIC_TEMPLATES
         #endif
         #if __has_feature(cxx_static_assert)
             #define HAS_STATIC_ASSERT
@@ -86,6 +86,10 @@
             // #define HAS_VARIADIC_TEMPLATES
             #define HAS_STATIC_ASSERT
         #endif
+        // pack expansions are complete from 4.7 on
+        #if GCC_VERSION >= 40700 && __cplusplus >= 201103L
+            #define HAS_VARIADIC_TEMPLATES
+        #endif
     #endif
 #endif
 
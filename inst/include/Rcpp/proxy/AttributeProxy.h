@@ -29,6 +29,9 @@ public:
         AttributeProxy( CLASS& v, const std::string& name)
             : parent(v), attr_name(Rf_install(name.c_str()))
         {}
+        AttributeProxy( CLASS& v, SEXP symbol )
+            : parent(v), attr_name(symbol)
+        {}
 
         AttributeProxy& operator=(const AttributeProxy& rhs){
             if( this != &rhs ) set( rhs.get() ) ;
@@ -64,6 +67,8 @@ public:
     public:
         const_AttributeProxy( const CLASS& v, const std::string& name)
             : parent(v), attr_name(Rf_install(name.c_str())){}
+        const_AttributeProxy( const CLASS& v, SEXP symbol )
+            : parent(v), attr_name(symbol){}
 
         template <typename T> operator T() const {
           return as<T>( get() );
@@ -88,6 +93,14 @@ public:
         return const_AttributeProxy( static_cast<const CLASS&>( *this ), name ) ;
     }
 
+    // same, without looking up the name in the symbol table
+    AttributeProxy attr( const Symbol& name){
+        return AttributeProxy( static_cast<CLASS&>( *this ), name ) ;
+    }
+    const_AttributeProxy attr( const Symbol& name) const {
+        return const_AttributeProxy( static_cast<const CLASS&>( *this ), name ) ;
+    }
+
     std::vector<std::string> attributeNames() const {
         std::vector<std::string> v ;
         SEXP attrs = ATTRIB( static_cast<const CLASS&>(*this).get__());
@@ -27,7 +27,9 @@ public:
     class Binding : public GenericProxy<Binding> {
     public:
         Binding( EnvironmentClass& env_, const std::string& name_) :
-            env(env_), name(name_){}
+            env(env_), name(Rf_install(name_.c_str())){}
+        Binding( EnvironmentClass& env_, SEXP symbol ) :
+            env(env_), name(symbol){}
 
         inline bool active() const {
             return env.bindingIsActive(name) ;
@@ -69,13 +71,16 @@ public:
         }
 
         EnvironmentClass& env ;
-        std::string name ;
+        // symbols are never collected
+        SEXP name ;
     } ;
 
     class const_Binding : public GenericProxy<const_Binding> {
     public:
         const_Binding( const EnvironmentClass& env_, const std::string& name_) :
-            env(env_), name(name_){}
+            env(env_), name(Rf_install(name_.c_str())){}
+        const_Binding( const EnvironmentClass& env_, SEXP symbol ) :
+            env(env_), name(symbol){}
 
         inline bool active() const {
             return env.bindingIsActive(name) ;
@@ -97,7 +102,8 @@ public:
         }
 
         const EnvironmentClass& env ;
-        std::string name ;
+        // symbols are never collected
+        SEXP name ;
     } ;
 
     const_Binding operator[]( const std::string& name) const {
@@ -106,6 +112,12 @@ public:
     Binding operator[](const std::string& name){
         return Binding( static_cast<EnvironmentClass&>(*this), name ) ;
     }
+    const_Binding operator[]( const Symbol& name) const {
+        return const_Binding( static_cast<const EnvironmentClass&>(*this), name ) ;
+    }
+    Binding operator[](const Symbol& name){
+        return Binding( static_cast<EnvironmentClass&>(*this), name ) ;
+    }
 
 } ;
 
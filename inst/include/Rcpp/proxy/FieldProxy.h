@@ -1,4 +1,4 @@
-// Copyright (C) 2013 Romain Francois
+// Copyright (C) 2013 - 2014 Romain Francois
 //
 // This file is part of Rcpp.
 //
@@ -20,6 +20,54 @@
 
 namespace Rcpp{
 
+namespace internal{
+
+    // The fields of a Reference class object are bindings in the
+    // environment of the object. When the binding is an ordinary one,
+    // it is read and written directly in that environment, otherwise
+    // (active bindings such as the ones checking the class of typed
+    // fields, locked bindings, methods, ...) this goes through the
+    // usual $ and $<- calls.
+
+    inline SEXP field_environment( SEXP object ){
+        if( TYPEOF(object) == ENVSXP ) return object ;
+        if( TYPEOF(object) == S4SXP ){
+            SEXP env = Rf_getAttrib( object, Rf_install(".xData") ) ;
+            if( TYPEOF(env) == ENVSXP ) return env ;
+        }
+        return R_NilValue ;
+    }
+
+    inline bool is_plain_field( SEXP env, SEXP symbol ){
+        return env != R_NilValue &&
+            R_existsVarInFrame( env, symbol ) &&
+            ! R_BindingIsActive( symbol, env ) ;
+    }
+
+    inline SEXP get_field( SEXP object, SEXP symbol ){
+        SEXP env = field_environment( object ) ;
+        if( is_plain_field( env, symbol ) ){
+            SEXP value = Rf_findVarInFrame( env, symbol ) ;
+            if( TYPEOF(value) != PROMSXP ) return value ;
+        }
+        Shield<SEXP> call( Rf_lang3( R_DollarSymbol, object, Rf_ScalarString( PRINTNAME(symbol) ) ) ) ;
+        return Rf_eval( call, R_GlobalEnv ) ;
+    }
+
+    // returns the object, as modified by $<-
+    inline SEXP set_field( SEXP object, SEXP symbol, SEXP value ){
+        SEXP env = field_environment( object ) ;
+        if( is_plain_field( env, symbol ) && ! R_BindingIsLocked( symbol, env ) ){
+            Rf_defineVar( symbol, value, env ) ;
+            return object ;
+        }
+        SEXP dollarGetsSym = Rf_install( "$<-");
+        Shield<SEXP> call( Rf_lang4( dollarGetsSym, object, Rf_ScalarString( PRINTNAME(symbol) ), value ) ) ;
+        return Rf_eval( call, R_GlobalEnv ) ;
+    }
+
+}
+
 template <typename CLASS>
 class FieldProxyPolicy {
 public:
@@ -27,7 +75,9 @@ public:
     class FieldProxy : public GenericProxy<FieldProxy> {
     public:
         FieldProxy( CLASS& v, const std::string& name) :
-            parent(v), field_name(name) {}
+            parent(v), field_name( Rf_install( name.c_str() ) ) {}
+        FieldProxy( CLASS& v, SEXP symbol ) :
+            parent(v), field_name( symbol ) {}
 
         FieldProxy& operator=(const FieldProxy& rhs){
             if( this != &rhs ) set( rhs.get() ) ;
@@ -50,23 +100,23 @@ public:
 
     private:
         CLASS& parent;
-        const std::string& field_name ;
+        SEXP field_name ;
 
         SEXP get() const {
-            Shield<SEXP> call( Rf_lang3( R_DollarSymbol, parent, Rf_mkString(field_name.c_str()) ) ) ;
-            return Rf_eval( call, R_GlobalEnv ) ;
+            return internal::get_field( parent, field_name ) ;
         }
         void set(SEXP x ) {
-            SEXP dollarGetsSym = Rf_install( "$<-");
-            Shield<SEXP> call( Rf_lang4( dollarGetsSym, parent, Rf_mkString(field_name.c_str()) , x ) ) ;
-            parent.set__( Rf_eval( call, R_GlobalEnv ) );
+            SEXP object = internal::set_field( parent, field_name, x ) ;
+            if( object != parent ) parent.set__( object ) ;
         }
     } ;
 
     class const_FieldProxy : public GenericProxy<const_FieldProxy> {
     public:
         const_FieldProxy( const CLASS& v, const std::string& name) :
-            parent(v), field_name(name) {}
+            parent(v), field_name( Rf_install( name.c_str() ) ) {}
+        const_FieldProxy( const CLASS& v, SEXP symbol ) :
+            parent(v), field_name( symbol ) {}
 
         template <typename T> operator T() const {
           return as<T>( get() );
@@ -77,11 +127,10 @@ public:
 
     private:
         const CLASS& parent;
-        const std::string& field_name ;
+        SEXP field_name ;
 
         SEXP get() const {
-            Shield<SEXP> call( Rf_lang3( R_DollarSymbol, parent, Rf_mkString(field_name.c_str()) ) ) ;
-            return Rf_eval( call, R_GlobalEnv ) ;
+            return internal::get_field( parent, field_name ) ;
         }
     } ;
 
@@ -92,6 +141,13 @@ public:
         return const_FieldProxy( static_cast<const CLASS&>(*this), name ) ;
     }
 
+    FieldProxy field(const Symbol& name){
+        return FieldProxy( static_cast<CLASS&>(*this), name ) ;
+    }
+    const_FieldProxy field(const Symbol& name) const {
+        return const_FieldProxy( static_cast<const CLASS&>(*this), name ) ;
+    }
+
 } ;
 
 }
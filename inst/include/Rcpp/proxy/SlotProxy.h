@@ -31,6 +31,11 @@ public:
                 throw no_such_slot() ;
             }
         }
+        SlotProxy( CLASS& v, SEXP symbol ) : parent(v), slot_name(symbol) {
+            if( !R_has_slot( v, slot_name) ){
+                throw no_such_slot() ;
+            }
+        }
 
         SlotProxy& operator=(const SlotProxy& rhs){
             set( rhs.get() ) ;
@@ -68,6 +73,11 @@ public:
                 throw no_such_slot() ;
             }
         }
+        const_SlotProxy( const CLASS& v, SEXP symbol ) : parent(v), slot_name(symbol) {
+            if( !R_has_slot( v, slot_name) ){
+                throw no_such_slot() ;
+            }
+        }
 
         template <typename T> operator T() const {
           return as<T>( get() );
@@ -96,6 +106,17 @@ public:
         return const_SlotProxy( static_cast<const CLASS&>(*this) , name ) ;
     }
 
+    SlotProxy slot(const Symbol& name){
+        SEXP x = static_cast<CLASS&>(*this) ;
+        if( !Rf_isS4(x) ) throw not_s4() ;
+        return SlotProxy( static_cast<CLASS&>(*this) , name ) ;
+    }
+    const_SlotProxy slot(const Symbol& name) const {
+        SEXP x = static_cast<const CLASS&>(*this) ;
+        if( !Rf_isS4(x) ) throw not_s4() ;
+        return const_SlotProxy( static_cast<const CLASS&>(*this) , name ) ;
+    }
+
     bool hasSlot(const std::string& name) const{
         SEXP x = static_cast<const CLASS&>(*this).get__() ;
         if( !Rf_isS4(x) ) throw not_s4() ;
@@ -23,6 +23,10 @@ namespace Rcpp {
     template <typename T> T as(SEXP);
     template <typename T> SEXP wrap(const T& object);
     inline SEXP wrap(const char* const v);
+
+    // the proxies take symbols, see Symbol.h
+    template < template <class> class StoragePolicy > class Symbol_Impl ;
+    typedef Symbol_Impl<NoProtectStorage> Symbol ;
 }
 
 #include <Rcpp/proxy/GenericProxy.h>
@@ -22,6 +22,59 @@
 #ifndef Rcpp__stats__binom_h
 #define Rcpp__stats__binom_h
 
-RCPP_DPQ_2(binom,::Rf_dbinom,::Rf_pbinom,::Rf_qbinom)
+namespace Rcpp {
+namespace stats {
+
+// kernel of dbinom, see dpq/batch.h
+class dbinom_kernel {
+public:
+    dbinom_kernel( double size_, double prob_, bool log_ ) :
+        size(size_), prob(prob_), log(log_), n(0), lfact(0)
+    {
+        log_p = ::log( prob ) ;
+        log_q = ::log1p( -prob ) ;
+        if( batchable() ){
+            n = static_cast<int>( size ) ;
+            lfact = lfactorial_table() ;
+            lfact_n = lfact[n] ;
+        }
+    }
+
+    inline bool batchable() const {
+        return size >= 0.0 && size < RCPP_STATS_LFACTORIAL_SIZE && size == ::floor( size ) &&
+            prob > 0.0 && prob < 1.0 ;
+    }
+
+    inline bool is_log() const { return log ; }
+
+    // log density: log(choose(size, x)) + x log(prob) + (size - x) log(1 - prob),
+    // for integer x
+    template <bool LOG>
+    inline double fast( double x, double& ok ) const {
+        double in = ( x >= 0.0 ) ? ( ( x <= size ) ? 1.0 : 0.0 ) : 0.0 ;
+        int k = ( in == 1.0 ) ? static_cast<int>( x ) : 0 ;
+        double lk = lfact[k], lnk = lfact[n - k] ;
+        double a = x * log_p, b = ( size - x ) * log_q ;
+        double res = ( lfact_n - lk - lnk ) + ( a + b ) ;
+        ok = ( x == k ) ? ( ( lfact_n + lk + lnk - a - b <= RCPP_STATS_BATCH_LOG_BOUND ) ? in : 0.0 ) : 0.0 ;
+        return LOG ? res : fast_exp( res ) ;
+    }
+
+    inline double exact( double x ) const {
+        return ::Rf_dbinom( x, size, prob, log ) ;
+    }
+
+private:
+    double size, prob, log_p, log_q, lfact_n ;
+    bool log ;
+    int n ;
+    const double* lfact ;
+} ;
+
+} // stats
+} // Rcpp
+
+RCPP_D_BATCH_2(binom,Rcpp::stats::dbinom_kernel)
+RCPP_PQ_2(binom,::Rf_pbinom,::Rf_qbinom)
 
 #endif
@@ -0,0 +1,285 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// batch.h: Rcpp R/C++ interface class library -- densities computed by blocks
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__stats__dpq__batch_h
+#define Rcpp__stats__dpq__batch_h
+
+#include <stdint.h>
+#include <cstring>
+#include <cfloat>
+
+// number of elements processed at once
+#ifndef RCPP_STATS_BATCH_BLOCK
+#define RCPP_STATS_BATCH_BLOCK 256
+#endif
+
+// the fast paths sum logarithms, they are only used when the sum of
+// the absolute values of the terms stays below this bound, which keeps
+// the relative error of the density around 1e-13
+#ifndef RCPP_STATS_BATCH_LOG_BOUND
+#define RCPP_STATS_BATCH_LOG_BOUND 256.0
+#endif
+
+// log factorials of 0, ..., RCPP_STATS_LFACTORIAL_SIZE - 1 are tabulated
+#ifndef RCPP_STATS_LFACTORIAL_SIZE
+#define RCPP_STATS_LFACTORIAL_SIZE 128
+#endif
+
+namespace Rcpp {
+namespace stats {
+
+    /*
+     * exp and log without function calls or branches, so that loops
+     * using them can be vectorized by the compiler. Both are within a
+     * couple of ulps of the C library.
+     *
+     * fast_exp is only meaningful for x in [-708, 708], where the result
+     * is a normal number, and fast_log for positive normal numbers. Other
+     * arguments give unspecified values.
+     */
+
+    inline double fast_exp( double x ){
+        // x = k log(2) + r, with |r| <= log(2)/2
+        double t = x * 1.4426950408889634 ;
+#ifdef __FAST_MATH__
+        // the shift below would be simplified away
+        t = ( ( t >= -1021.0 ) & ( t <= 1021.0 ) ) ? t : 0.0 ;
+        double k = static_cast<int>( t + 1024.5 ) - 1024 ;
+        uint64_t bits = static_cast<uint64_t>( k + 1023.0 ) << 52 ;
+#else
+        // adding 1.5 2^52 rounds t to the nearest integer k, which ends
+        // up in the low bits of the sum
+        const double shift = 6755399441055744.0 ;
+        double sum = t + shift ;
+        double k = sum - shift ;
+        uint64_t bits ;
+        std::memcpy( &bits, &sum, sizeof(double) ) ;
+        bits = ( bits + 1023 ) << 52 ;
+#endif
+        double r = x - k * 6.93147180369123816490e-01 - k * 1.90821492927058770002e-10 ;
+
+        // Taylor series, the first omitted term is below 1e-17
+        double p = 1.0 / 6227020800.0 ;
+        p = p * r + 1.0 / 479001600.0 ;
+        p = p * r + 1.0 / 39916800.0 ;
+        p = p * r + 1.0 / 3628800.0 ;
+        p = p * r + 1.0 / 362880.0 ;
+        p = p * r + 1.0 / 40320.0 ;
+        p = p * r + 1.0 / 5040.0 ;
+        p = p * r + 1.0 / 720.0 ;
+        p = p * r + 1.0 / 120.0 ;
+        p = p * r + 1.0 / 24.0 ;
+        p = p * r + 1.0 / 6.0 ;
+        p = p * r + 0.5 ;
+        p = p * r + 1.0 ;
+        p = p * r + 1.0 ;
+
+        // bits is 2^k
+        double scale ;
+        std::memcpy( &scale, &bits, sizeof(double) ) ;
+        return p * scale ;
+    }
+
+    inline double fast_log( double x ){
+        // x = 2^e m, with sqrt(2)/2 <= m < sqrt(2). Adding the bits of
+        // 1/sqrt(2) carries into the exponent when m >= sqrt(2)
+        const uint64_t sqrt_half = ( static_cast<uint64_t>(0x3FE6A09Eu) << 32 ) | 0x667F3BCDu ;
+        const uint64_t one = static_cast<uint64_t>(1023) << 52 ;
+        const uint64_t mask = ( static_cast<uint64_t>(1) << 52 ) - 1 ;
+        uint64_t bits ;
+        std::memcpy( &bits, &x, sizeof(double) ) ;
+        bits += one - sqrt_half ;
+        uint64_t mantissa = ( bits & mask ) + sqrt_half ;
+        // the biased exponent, read as the double 2^52 + exponent
+        uint64_t exponent = ( bits >> 52 ) | ( static_cast<uint64_t>(0x433) << 52 ) ;
+        double m, e ;
+        std::memcpy( &m, &mantissa, sizeof(double) ) ;
+        std::memcpy( &e, &exponent, sizeof(double) ) ;
+        e -= 4503599627370496.0 + 1023.0 ;
+
+        // log(1+f) = 2s + s^3 2/3 + s^5 2/5 + ... with s = f/(2+f),
+        // written as in fdlibm: f - ( f^2/2 - s ( f^2/2 + R ) )
+        double f = m - 1.0 ;
+        double s = f / ( 2.0 + f ) ;
+        double s2 = s * s ;
+        double R = 2.0 / 21.0 ;
+        R = R * s2 + 2.0 / 19.0 ;
+        R = R * s2 + 2.0 / 17.0 ;
+        R = R * s2 + 2.0 / 15.0 ;
+        R = R * s2 + 2.0 / 13.0 ;
+        R = R * s2 + 2.0 / 11.0 ;
+        R = R * s2 + 2.0 / 9.0 ;
+        R = R * s2 + 2.0 / 7.0 ;
+        R = R * s2 + 2.0 / 5.0 ;
+        R = R * s2 + 2.0 / 3.0 ;
+        R = R * s2 ;
+        double hfsq = 0.5 * f * f ;
+        return e * 6.93147180369123816490e-01 +
+            ( ( f - ( hfsq - s * ( hfsq + R ) ) ) + e * 1.90821492927058770002e-10 ) ;
+    }
+
+    /*
+     * The fast paths report whether their result is valid with a double
+     * flag, 1.0 or 0.0. Flags are combined with nested conditionals rather
+     * than with & on int or bool values, the compiler only vectorizes the
+     * former when floating point comparisons may trap.
+     */
+    inline double is_normal_positive( double x ){
+        return ( x >= DBL_MIN ) ? ( ( x <= DBL_MAX ) ? 1.0 : 0.0 ) : 0.0 ;
+    }
+
+    /**
+     * log(k!) for k = 0, ..., RCPP_STATS_LFACTORIAL_SIZE - 1, computed by
+     * R the first time it is needed
+     */
+    inline const double* lfactorial_table(){
+        static double table[ RCPP_STATS_LFACTORIAL_SIZE ] ;
+        static bool ready = false ;
+        if( !ready ){
+            for( int k=0; k<RCPP_STATS_LFACTORIAL_SIZE; k++){
+                table[k] = ::Rf_lgammafn( k + 1.0 ) ;
+            }
+            ready = true ;
+        }
+        return table ;
+    }
+
+    /*
+     * A density with a batch kernel is the lazy expression DBatch, holding
+     * a KERNEL object that has the parameters of the distribution and:
+     *
+     *   bool batchable() const          whether the parameters allow the fast path
+     *   bool is_log() const             whether the log density is computed
+     *   double fast<LOG>(x, double& ok) density at x, only valid when ok is set to 1.0
+     *   double exact(double x)          density at x, by the R function
+     *
+     * fast() must not branch on x, so that a loop calling it over a block
+     * can be vectorized. When the expression is stored in a numeric vector,
+     * each block of RCPP_STATS_BATCH_BLOCK elements is first computed by
+     * fast(), and then the elements it did not handle (NA, tails, non
+     * integers, ...) are computed again by exact(). Defining
+     * RCPP_STATS_NO_BATCH makes all elements go through exact().
+     */
+    template <typename KERNEL, int RTYPE, bool NA, typename T>
+    class DBatch : public Rcpp::VectorBase< REALSXP, NA, DBatch<KERNEL,RTYPE,NA,T> > {
+    public:
+        typedef typename Rcpp::VectorBase<RTYPE,NA,T> VEC_TYPE ;
+
+        DBatch( const KERNEL& kernel_, const VEC_TYPE& vec_ ) :
+            kernel(kernel_), vec(vec_), use_fast(kernel_.batchable())
+        {
+#ifdef RCPP_STATS_NO_BATCH
+            use_fast = false ;
+#endif
+        }
+
+        inline double operator[]( int i ) const {
+            double x = vec[i] ;
+            if( use_fast ){
+                double ok ;
+                double res = kernel.is_log() ?
+                    kernel.template fast<true>( x, ok ) :
+                    kernel.template fast<false>( x, ok ) ;
+                if( ok != 0.0 ) return res ;
+            }
+            return kernel.exact( x ) ;
+        }
+
+        inline int size() const { return vec.size() ; }
+
+        inline void import_into( double* out, int n ) const {
+            if( !use_fast ){
+                for( int i=0; i<n; i++) out[i] = kernel.exact( vec[i] ) ;
+                return ;
+            }
+            if( kernel.is_log() ){
+                import_blocks<true>( out, n ) ;
+            } else {
+                import_blocks<false>( out, n ) ;
+            }
+        }
+
+        template <typename ITERATOR>
+        inline void import_into( ITERATOR out, int n ) const {
+            for( int i=0; i<n; i++, ++out) *out = operator[](i) ;
+        }
+
+    private:
+
+        // the input is copied first so that out may be the input
+        template <bool LOG>
+        void import_blocks( double* out, int n ) const {
+            double x[ RCPP_STATS_BATCH_BLOCK ] ;
+            double ok[ RCPP_STATS_BATCH_BLOCK ] ;
+            for( int start=0; start<n; start += RCPP_STATS_BATCH_BLOCK ){
+                int m = std::min( RCPP_STATS_BATCH_BLOCK, n - start ) ;
+                double* res = out + start ;
+                for( int i=0; i<m; i++) x[i] = vec[start + i] ;
+                for( int i=0; i<m; i++){
+                    res[i] = kernel.template fast<LOG>( x[i], ok[i] ) ;
+                }
+                for( int i=0; i<m; i++){
+                    if( ok[i] == 0.0 ) res[i] = kernel.exact( x[i] ) ;
+                }
+            }
+        }
+
+        KERNEL kernel ;
+        const VEC_TYPE& vec ;
+        bool use_fast ;
+    } ;
+
+} // stats
+} // Rcpp
+
+/*
+ * d<NAME> functions backed by a kernel. KERNEL is constructed from the
+ * parameters given to d<NAME> followed by the log flag.
+ */
+
+#define RCPP_D_BATCH_0(__NAME__,__KERNEL__)                                            \
+namespace Rcpp {                                                                       \
+template <int RTYPE, bool NA, typename T>                                              \
+inline stats::DBatch<__KERNEL__,RTYPE,NA,T> d##__NAME__(                               \
+	const Rcpp::VectorBase<RTYPE,NA,T>& x, bool log = false                            \
+) {                                                                                    \
+	return stats::DBatch<__KERNEL__,RTYPE,NA,T>( __KERNEL__( log ), x );               \
+} }
+
+#define RCPP_D_BATCH_1(__NAME__,__KERNEL__)                                            \
+namespace Rcpp {                                                                       \
+template <int RTYPE, bool NA, typename T>                                              \
+inline stats::DBatch<__KERNEL__,RTYPE,NA,T> d##__NAME__(                               \
+	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, bool log = false                 \
+) {                                                                                    \
+	return stats::DBatch<__KERNEL__,RTYPE,NA,T>( __KERNEL__( p0, log ), x );           \
+} }
+
+#define RCPP_D_BATCH_2(__NAME__,__KERNEL__)                                            \
+namespace Rcpp {                                                                       \
+template <int RTYPE, bool NA, typename T>                                              \
+inline stats::DBatch<__KERNEL__,RTYPE,NA,T> d##__NAME__(                               \
+	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, double p1, bool log = false      \
+) {                                                                                    \
+	return stats::DBatch<__KERNEL__,RTYPE,NA,T>( __KERNEL__( p0, p1, log ), x );       \
+} }
+
+#endif
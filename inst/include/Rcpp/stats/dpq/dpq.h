@@ -23,6 +23,7 @@
 #define Rcpp__stats__dpq__dpq_h
 
 #include <Rcpp/stats/dpq/macros.h>
+#include <Rcpp/stats/dpq/batch.h>
 
 namespace Rcpp {
 namespace stats {
@@ -318,14 +319,17 @@ namespace stats {
 } // stats
 } // Rcpp
 
-#define RCPP_DPQ_0(__NAME__,__D__,__P__,__Q__)                                         \
+#define RCPP_D_0(__NAME__,__D__)                                                       \
 namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::D0<RTYPE,NA,T> d##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, bool log = false                          \
 ) {                                                                                    \
 	return stats::D0<RTYPE,NA,T>( __D__, x, log );                                           \
-}                                                                                      \
+} }
+
+#define RCPP_PQ_0(__NAME__,__P__,__Q__)                                                \
+namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::P0<RTYPE,NA,T> p##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, bool lower = true, bool log = false       \
@@ -339,15 +343,22 @@ inline stats::Q0<RTYPE,NA,T> q##__NAME__(
 	return stats::Q0<RTYPE,NA,T>( __Q__, x, lower, log );                                    \
 } }
 
+#define RCPP_DPQ_0(__NAME__,__D__,__P__,__Q__)                                         \
+RCPP_D_0(__NAME__,__D__)                                                               \
+RCPP_PQ_0(__NAME__,__P__,__Q__)
 
-#define RCPP_DPQ_1(__NAME__,__D__,__P__,__Q__)                                         \
+
+#define RCPP_D_1(__NAME__,__D__)                                                       \
 namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::D1<RTYPE,NA,T> d##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, bool log = false                          \
 ) {                                                                                    \
 	return stats::D1<RTYPE,NA,T>( __D__, x, p0, log );                                           \
-}                                                                                      \
+} }
+
+#define RCPP_PQ_1(__NAME__,__P__,__Q__)                                                \
+namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::P1<RTYPE,NA,T> p##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, bool lower = true, bool log = false       \
@@ -361,16 +372,23 @@ inline stats::Q1<RTYPE,NA,T> q##__NAME__(
 	return stats::Q1<RTYPE,NA,T>( __Q__, x, p0, lower, log );                                    \
 } }
 
+#define RCPP_DPQ_1(__NAME__,__D__,__P__,__Q__)                                         \
+RCPP_D_1(__NAME__,__D__)                                                               \
+RCPP_PQ_1(__NAME__,__P__,__Q__)
 
 
-#define RCPP_DPQ_2(__NAME__,__D__,__P__,__Q__)                                         \
+
+#define RCPP_D_2(__NAME__,__D__)                                                       \
 namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::D2<RTYPE,NA,T> d##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, double p1, bool log = false                          \
 ) {                                                                                    \
 	return stats::D2<RTYPE,NA,T>( __D__, x, p0, p1, log );                                           \
-}                                                                                      \
+} }
+
+#define RCPP_PQ_2(__NAME__,__P__,__Q__)                                                \
+namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::P2<RTYPE,NA,T> p##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, double p1, bool lower = true, bool log = false       \
@@ -384,16 +402,23 @@ inline stats::Q2<RTYPE,NA,T> q##__NAME__(
 	return stats::Q2<RTYPE,NA,T>( __Q__, x, p0, p1, lower, log );                                    \
 } }
 
+#define RCPP_DPQ_2(__NAME__,__D__,__P__,__Q__)                                         \
+RCPP_D_2(__NAME__,__D__)                                                               \
+RCPP_PQ_2(__NAME__,__P__,__Q__)
 
 
-#define RCPP_DPQ_3(__NAME__,__D__,__P__,__Q__)                                         \
+
+#define RCPP_D_3(__NAME__,__D__)                                                       \
 namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::D3<RTYPE,NA,T> d##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, double p1, double p2, bool log = false                          \
 ) {                                                                                    \
 	return stats::D3<RTYPE,NA,T>( __D__, x, p0, p1, p2, log );                                           \
-}                                                                                      \
+} }
+
+#define RCPP_PQ_3(__NAME__,__P__,__Q__)                                                \
+namespace Rcpp {                                                                       \
 template <int RTYPE, bool NA, typename T>                                                         \
 inline stats::P3<RTYPE,NA,T> p##__NAME__(                                                    \
 	const Rcpp::VectorBase<RTYPE,NA,T>& x, double p0, double p1, double p2, bool lower = true, bool log = false       \
@@ -407,5 +432,9 @@ inline stats::Q3<RTYPE,NA,T> q##__NAME__(
 	return stats::Q3<RTYPE,NA,T>( __Q__, x, p0, p1, p2, lower, log );                                    \
 } }
 
+#define RCPP_DPQ_3(__NAME__,__D__,__P__,__Q__)                                         \
+RCPP_D_3(__NAME__,__D__)                                                               \
+RCPP_PQ_3(__NAME__,__P__,__Q__)
+
 
 #endif
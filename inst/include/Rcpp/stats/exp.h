@@ -68,17 +68,52 @@ namespace stats {
     return R_D_exp(x);
 }
 
+// kernel of dexp, see dpq/batch.h
+class dexp_kernel {
+public:
+    dexp_kernel( bool log_ ) : scale(1.0), log(log_) { init() ; }
+    dexp_kernel( double rate, bool log_ ) : scale(1.0/rate), log(log_) { init() ; }
+
+    inline bool batchable() const {
+        return R_FINITE(scale) && scale > 0.0 ;
+    }
+
+    inline bool is_log() const { return log ; }
+
+    template <bool LOG>
+    inline double fast( double x, double& ok ) const {
+        double t = x / scale ;
+        if( LOG ){
+            ok = ( x >= 0.0 ) ? ( ( x <= DBL_MAX ) ? 1.0 : 0.0 ) : 0.0 ;
+            return -t - log_scale ;
+        }
+        ok = ( x >= 0.0 ) ? ( ( t <= RCPP_STATS_BATCH_LOG_BOUND ) ? 1.0 : 0.0 ) : 0.0 ;
+        return fast_exp( -t ) / scale ;
+    }
+
+    inline double exact( double x ) const {
+        return ::Rf_dexp( x, scale, log ) ;
+    }
+
+private:
+    void init(){ log_scale = ::log( scale ) ; }
+
+    double scale, log_scale ;
+    bool log ;
+} ;
+
 } // stats
 } // Rcpp
 
-RCPP_DPQ_0(exp,Rcpp::stats::d_exp_0,Rcpp::stats::p_exp_0,Rcpp::stats::q_exp_0)
+RCPP_D_BATCH_0(exp,Rcpp::stats::dexp_kernel)
+RCPP_PQ_0(exp,Rcpp::stats::p_exp_0,Rcpp::stats::q_exp_0)
 
 namespace Rcpp{
 
 // we cannot use the RCPP_DPQ_1 macro here because of rate and shape
 template <bool NA, typename T>
-inline stats::D1<REALSXP,NA,T> dexp( const Rcpp::VectorBase<REALSXP,NA,T>& x, double shape, bool log = false ) {
-	return stats::D1<REALSXP,NA,T>( ::Rf_dexp, x, 1.0/shape, log );
+inline stats::DBatch<stats::dexp_kernel,REALSXP,NA,T> dexp( const Rcpp::VectorBase<REALSXP,NA,T>& x, double shape, bool log = false ) {
+	return stats::DBatch<stats::dexp_kernel,REALSXP,NA,T>( stats::dexp_kernel( shape, log ), x );
 }
 
 template <bool NA, typename T>
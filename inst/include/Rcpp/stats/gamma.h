@@ -61,15 +61,57 @@ inline double qgamma_1(double p, double alpha, int lower_tail, int log_p){
 	return ::Rf_qgamma(p, alpha, 1.0, lower_tail, log_p );
 }
 
+// kernel of dgamma, see dpq/batch.h
+class dgamma_kernel {
+public:
+    dgamma_kernel( double shape_, bool log_ ) : shape(shape_), scale(1.0), log(log_) { init() ; }
+    dgamma_kernel( double shape_, double scale_, bool log_ ) : shape(shape_), scale(scale_), log(log_) { init() ; }
+
+    inline bool batchable() const {
+        return R_FINITE(shape) && shape > 0.0 && R_FINITE(scale) && scale > 0.0 &&
+            constant_terms <= RCPP_STATS_BATCH_LOG_BOUND ;
+    }
+
+    inline bool is_log() const { return log ; }
+
+    // log density: (shape-1) log(x) - x/scale - lgamma(shape) - shape log(scale)
+    template <bool LOG>
+    inline double fast( double x, double& ok ) const {
+        double a = ( shape - 1.0 ) * fast_log( x ) ;
+        double t = x / scale ;
+        double res = a - t - constant ;
+        ok = ( std::fabs( a ) + t + constant_terms <= RCPP_STATS_BATCH_LOG_BOUND ) ?
+            is_normal_positive( x ) : 0.0 ;
+        return LOG ? res : fast_exp( res ) ;
+    }
+
+    inline double exact( double x ) const {
+        return ::Rf_dgamma( x, shape, scale, log ) ;
+    }
+
+private:
+    void init(){
+        double lg = ::Rf_lgammafn( shape ) ;
+        double ls = shape * ::log( scale ) ;
+        constant = lg + ls ;
+        constant_terms = std::fabs( lg ) + std::fabs( ls ) ;
+    }
+
+    double shape, scale, constant, constant_terms ;
+    bool log ;
+} ;
+
 }
 }
 
 // 1 parameter case (scale = 1)
-RCPP_DPQ_1(gamma,Rcpp::stats::dgamma_1,Rcpp::stats::pgamma_1, Rcpp::stats::qgamma_1)
+RCPP_D_BATCH_1(gamma,Rcpp::stats::dgamma_kernel)
+RCPP_PQ_1(gamma,Rcpp::stats::pgamma_1, Rcpp::stats::qgamma_1)
 
 
 // 2 parameter case
-RCPP_DPQ_2(gamma,::Rf_dgamma,::Rf_pgamma,::Rf_qgamma)
+RCPP_D_BATCH_2(gamma,Rcpp::stats::dgamma_kernel)
+RCPP_PQ_2(gamma,::Rf_pgamma,::Rf_qgamma)
 
 
 #endif
@@ -107,12 +107,54 @@ inline double qlnorm_1(double p, double meanlog, int lower_tail, int log_p){
     return ::exp(::Rf_qnorm5(p, meanlog, 1.0, lower_tail, log_p));
 }
 
+// kernel of dlnorm, see dpq/batch.h
+class dlnorm_kernel {
+public:
+    dlnorm_kernel( bool log_ ) : meanlog(0.0), sdlog(1.0), log(log_) { init() ; }
+    dlnorm_kernel( double meanlog_, bool log_ ) : meanlog(meanlog_), sdlog(1.0), log(log_) { init() ; }
+    dlnorm_kernel( double meanlog_, double sdlog_, bool log_ ) : meanlog(meanlog_), sdlog(sdlog_), log(log_) { init() ; }
+
+    inline bool batchable() const {
+        return R_FINITE(meanlog) && R_FINITE(sdlog) && sdlog > 0.0 ;
+    }
+
+    inline bool is_log() const { return log ; }
+
+    template <bool LOG>
+    inline double fast( double x, double& ok ) const {
+        double lx = fast_log( x ) ;
+        double y = ( lx - meanlog ) / sdlog ;
+        double y2 = 0.5 * y * y ;
+        double res = -( y2 + ( lx + log_sdlog ) ) ;
+        if( LOG ){
+            ok = is_normal_positive( x ) ;
+            return res - M_LN_SQRT_2PI ;
+        }
+        ok = ( y2 + std::fabs( lx ) + std::fabs( log_sdlog ) <= RCPP_STATS_BATCH_LOG_BOUND ) ?
+            is_normal_positive( x ) : 0.0 ;
+        return M_1_SQRT_2PI * fast_exp( res ) ;
+    }
+
+    inline double exact( double x ) const {
+        return ::Rf_dlnorm( x, meanlog, sdlog, log ) ;
+    }
+
+private:
+    void init(){ log_sdlog = ::log( sdlog ) ; }
+
+    double meanlog, sdlog, log_sdlog ;
+    bool log ;
+} ;
+
 } // stats
 } // Rcpp
 
-RCPP_DPQ_0(lnorm,Rcpp::stats::dlnorm_0,Rcpp::stats::plnorm_0,Rcpp::stats::qlnorm_0)
-RCPP_DPQ_1(lnorm,Rcpp::stats::dlnorm_1,Rcpp::stats::plnorm_1,Rcpp::stats::qlnorm_1)
-RCPP_DPQ_2(lnorm,::Rf_dlnorm,::Rf_plnorm,::Rf_qlnorm)
+RCPP_D_BATCH_0(lnorm,Rcpp::stats::dlnorm_kernel)
+RCPP_D_BATCH_1(lnorm,Rcpp::stats::dlnorm_kernel)
+RCPP_D_BATCH_2(lnorm,Rcpp::stats::dlnorm_kernel)
+RCPP_PQ_0(lnorm,Rcpp::stats::plnorm_0,Rcpp::stats::qlnorm_0)
+RCPP_PQ_1(lnorm,Rcpp::stats::plnorm_1,Rcpp::stats::qlnorm_1)
+RCPP_PQ_2(lnorm,::Rf_plnorm,::Rf_qlnorm)
 
 #endif
 
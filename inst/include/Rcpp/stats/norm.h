@@ -100,11 +100,51 @@ inline double qnorm_0(double p /*, double mu [=0.], double sigma [=1.] */, int l
 	return ::Rf_qnorm5(p, 0.0, 1.0, lower_tail, log_p ) ;
 }
 
+// kernel of dnorm, see dpq/batch.h
+class dnorm_kernel {
+public:
+    dnorm_kernel( bool log_ ) : mu(0.0), sigma(1.0), log(log_) { init() ; }
+    dnorm_kernel( double mu_, bool log_ ) : mu(mu_), sigma(1.0), log(log_) { init() ; }
+    dnorm_kernel( double mu_, double sigma_, bool log_ ) : mu(mu_), sigma(sigma_), log(log_) { init() ; }
+
+    inline bool batchable() const {
+        return R_FINITE(mu) && R_FINITE(sigma) && sigma > 0.0 ;
+    }
+
+    inline bool is_log() const { return log ; }
+
+    template <bool LOG>
+    inline double fast( double x, double& ok ) const {
+        double z = ( x - mu ) / sigma ;
+        double z2 = 0.5 * z * z ;
+        if( LOG ){
+            ok = ( z - z == 0.0 ) ? 1.0 : 0.0 ;
+            return -( M_LN_SQRT_2PI + z2 + log_sigma ) ;
+        }
+        // R is more careful beyond 5 standard deviations
+        ok = ( z2 < 12.5 ) ? 1.0 : 0.0 ;
+        return M_1_SQRT_2PI * fast_exp( -z2 ) / sigma ;
+    }
+
+    inline double exact( double x ) const {
+        return ::Rf_dnorm4( x, mu, sigma, log ) ;
+    }
+
+private:
+    void init(){ log_sigma = ::log( sigma ) ; }
+
+    double mu, sigma, log_sigma ;
+    bool log ;
+} ;
+
 } // stats
 } // Rcpp
 
-RCPP_DPQ_0(norm, Rcpp::stats::dnorm_0, Rcpp::stats::pnorm_0, Rcpp::stats::qnorm_0 )
-RCPP_DPQ_1(norm, Rcpp::stats::dnorm_1, Rcpp::stats::pnorm_1, Rcpp::stats::qnorm_1 )
-RCPP_DPQ_2(norm, ::Rf_dnorm4, ::Rf_pnorm5, ::Rf_qnorm5 )
+RCPP_D_BATCH_0(norm, Rcpp::stats::dnorm_kernel )
+RCPP_D_BATCH_1(norm, Rcpp::stats::dnorm_kernel )
+RCPP_D_BATCH_2(norm, Rcpp::stats::dnorm_kernel )
+RCPP_PQ_0(norm, Rcpp::stats::pnorm_0, Rcpp::stats::qnorm_0 )
+RCPP_PQ_1(norm, Rcpp::stats::pnorm_1, Rcpp::stats::qnorm_1 )
+RCPP_PQ_2(norm, ::Rf_pnorm5, ::Rf_qnorm5 )
 
 #endif
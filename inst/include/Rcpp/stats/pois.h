@@ -22,6 +22,49 @@
 #ifndef Rcpp__stats__pois_h
 #define Rcpp__stats__pois_h
 
-RCPP_DPQ_1(pois,::Rf_dpois,::Rf_ppois,::Rf_qpois)
+namespace Rcpp {
+namespace stats {
+
+// kernel of dpois, see dpq/batch.h
+class dpois_kernel {
+public:
+    dpois_kernel( double lambda_, bool log_ ) : lambda(lambda_), log(log_), lfact(0) {
+        log_lambda = ::log( lambda ) ;
+        if( batchable() ) lfact = lfactorial_table() ;
+    }
+
+    inline bool batchable() const {
+        return R_FINITE(lambda) && lambda > 0.0 && lambda <= RCPP_STATS_BATCH_LOG_BOUND ;
+    }
+
+    inline bool is_log() const { return log ; }
+
+    // log density: x log(lambda) - lambda - log(x!), for integer x
+    template <bool LOG>
+    inline double fast( double x, double& ok ) const {
+        double in = ( x >= 0.0 ) ? ( ( x < RCPP_STATS_LFACTORIAL_SIZE ) ? 1.0 : 0.0 ) : 0.0 ;
+        int k = ( in == 1.0 ) ? static_cast<int>( x ) : 0 ;
+        double lf = lfact[k] ;
+        double a = x * log_lambda ;
+        double res = a - lambda - lf ;
+        ok = ( x == k ) ? ( ( std::fabs( a ) + lambda + lf <= RCPP_STATS_BATCH_LOG_BOUND ) ? in : 0.0 ) : 0.0 ;
+        return LOG ? res : fast_exp( res ) ;
+    }
+
+    inline double exact( double x ) const {
+        return ::Rf_dpois( x, lambda, log ) ;
+    }
+
+private:
+    double lambda, log_lambda ;
+    bool log ;
+    const double* lfact ;
+} ;
+
+} // stats
+} // Rcpp
+
+RCPP_D_BATCH_1(pois,Rcpp::stats::dpois_kernel)
+RCPP_PQ_1(pois,::Rf_ppois,::Rf_qpois)
 
 #endif
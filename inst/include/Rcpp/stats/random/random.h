@@ -30,13 +30,33 @@ public:
 	~RNGScope(){ internal::exitRNGScope(); }
 } ;
 
+/**
+ * RNG policy of the generators in Rcpp::stats drawing from the generator
+ * of R, see stream.h for the alternative
+ */
+class RGlobalRNG {
+public:
+	inline double unif_rand() const { return ::unif_rand() ; }
+	inline double norm_rand() const { return ::norm_rand() ; }
+	inline double exp_rand() const { return ::exp_rand() ; }
+	inline double gamma_rand( double a, double scale ) const { return ::Rf_rgamma( a, scale ) ; }
+} ;
+
+template <typename T, typename RNG = RGlobalRNG>
+class Generator {
+public:
+	typedef T r_generator ;
+} ;
+
+// generators using the generator of R keep it in scope while they live
 template <typename T>
-class Generator : public RNGScope {
+class Generator<T,RGlobalRNG> : public RNGScope {
 public:
 	typedef T r_generator ;
 } ;
 
 }
+#include <Rcpp/stats/random/stream.h>
 #include <Rcpp/stats/random/rnorm.h>
 #include <Rcpp/stats/random/runif.h>
 #include <Rcpp/stats/random/rgamma.h>
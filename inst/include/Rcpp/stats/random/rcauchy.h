@@ -25,19 +25,22 @@
 namespace Rcpp {
 namespace stats {
 
-class CauchyGenerator : public ::Rcpp::Generator<double> {
+template <typename RNG>
+class CauchyGenerator_Impl : public ::Rcpp::Generator<double,RNG> {
 public:
 
-	CauchyGenerator( double location_, double scale_) :
-		location(location_) , scale(scale_) {}
+	CauchyGenerator_Impl( double location_, double scale_, const RNG& rng_ = RNG() ) :
+		location(location_) , scale(scale_), rng(rng_) {}
 
 	inline double operator()() const {
-		return location + scale * ::tan(M_PI * unif_rand()) ;
+		return location + scale * ::tan(M_PI * rng.unif_rand()) ;
 	}
 
 private:
 	double location, scale ;
+	RNG rng ;
 } ;
+typedef CauchyGenerator_Impl<RGlobalRNG> CauchyGenerator ;
 
 class CauchyGenerator_1 : public ::Rcpp::Generator<double> {
 public:
@@ -26,18 +26,21 @@ namespace Rcpp {
 	namespace stats {
 
 
-		class ChisqGenerator : public ::Rcpp::Generator<double> {
+		template <typename RNG>
+		class ChisqGenerator_Impl : public ::Rcpp::Generator<double,RNG> {
 		public:
 
-			ChisqGenerator( double df_ ) : df_2(df_ / 2.0) {}
+			ChisqGenerator_Impl( double df_, const RNG& rng_ = RNG() ) : df_2(df_ / 2.0), rng(rng_) {}
 
 			inline double operator()() const {
-				return ::Rf_rgamma( df_2, 2.0 ) ;
+				return rng.gamma_rand( df_2, 2.0 ) ;
 			}
 
 		private:
 			double df_2 ;
+			RNG rng ;
 		} ;
+		typedef ChisqGenerator_Impl<RGlobalRNG> ChisqGenerator ;
 	} // stats
 
 } // Rcpp
@@ -26,18 +26,21 @@ namespace Rcpp {
 	namespace stats {
 
 
-		class ExpGenerator : public ::Rcpp::Generator<double> {
+		template <typename RNG>
+		class ExpGenerator_Impl : public ::Rcpp::Generator<double,RNG> {
 		public:
 
-			ExpGenerator( double scale_ ) : scale(scale_) {}
+			ExpGenerator_Impl( double scale_, const RNG& rng_ = RNG() ) : scale(scale_), rng(rng_) {}
 
 			inline double operator()() const {
-				return scale * exp_rand() ;
+				return scale * rng.exp_rand() ;
 			}
 
 		private:
 			double scale ;
+			RNG rng ;
 		} ;
+		typedef ExpGenerator_Impl<RGlobalRNG> ExpGenerator ;
 
 
 		class ExpGenerator__rate1 : public Generator<double>{
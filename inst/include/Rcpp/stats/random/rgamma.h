@@ -25,14 +25,17 @@
 namespace Rcpp {
     namespace stats {
 
-        class GammaGenerator : public Generator<double>{
+        template <typename RNG>
+        class GammaGenerator_Impl : public Generator<double,RNG>{
         public:
-            GammaGenerator(double a_, double scale_) :
-                a(a_), scale(scale_) {}
-            inline double operator()() const { return ::Rf_rgamma(a, scale ) ;}
+            GammaGenerator_Impl(double a_, double scale_, const RNG& rng_ = RNG()) :
+                a(a_), scale(scale_), rng(rng_) {}
+            inline double operator()() const { return rng.gamma_rand(a, scale ) ;}
         private:
             double a, scale ;
+            RNG rng ;
         } ;
+        typedef GammaGenerator_Impl<RGlobalRNG> GammaGenerator ;
     }    // stats
 
 
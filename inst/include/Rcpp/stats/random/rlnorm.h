@@ -26,20 +26,23 @@ namespace Rcpp {
 	namespace stats {
 
 
-		class LNormGenerator : public Generator<double> {
+		template <typename RNG>
+		class LNormGenerator_Impl : public Generator<double,RNG> {
 		public:
 
-			LNormGenerator( double meanlog_ = 0.0 , double sdlog_ = 1.0 ) :
-				meanlog(meanlog_), sdlog(sdlog_) {}
+			LNormGenerator_Impl( double meanlog_ = 0.0 , double sdlog_ = 1.0, const RNG& rng_ = RNG() ) :
+				meanlog(meanlog_), sdlog(sdlog_), rng(rng_) {}
 
 			inline double operator()() const {
-				return ::exp( meanlog + sdlog * ::norm_rand() ) ;
+				return ::exp( meanlog + sdlog * rng.norm_rand() ) ;
 			}
 
 		private:
 			double meanlog ;
 			double sdlog ;
+			RNG rng ;
 		} ;
+		typedef LNormGenerator_Impl<RGlobalRNG> LNormGenerator ;
 
 
 		class LNormGenerator_1 : public Generator<double> {
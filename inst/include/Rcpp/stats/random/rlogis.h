@@ -26,21 +26,24 @@ namespace Rcpp {
 	namespace stats {
 
 
-		class LogisGenerator : public ::Rcpp::Generator<double> {
+		template <typename RNG>
+		class LogisGenerator_Impl : public ::Rcpp::Generator<double,RNG> {
 		public:
 
-			LogisGenerator( double location_, double scale_ ) :
-				location(location_), scale(scale_) {}
+			LogisGenerator_Impl( double location_, double scale_, const RNG& rng_ = RNG() ) :
+				location(location_), scale(scale_), rng(rng_) {}
 
 			inline double operator()() const {
-				double u = unif_rand() ;
+				double u = rng.unif_rand() ;
 				return location + scale * ::log(u / (1. - u));
 			}
 
 		private:
 			double location ;
 			double scale ;
+			RNG rng ;
 		} ;
+		typedef LogisGenerator_Impl<RGlobalRNG> LogisGenerator ;
 
 
 		class LogisGenerator_1 : public ::Rcpp::Generator<double> {
@@ -26,20 +26,23 @@ namespace Rcpp {
 	namespace stats {
 
 
-		class NormGenerator : public Generator<double> {
+		template <typename RNG>
+		class NormGenerator_Impl : public Generator<double,RNG> {
 		public:
 
-			NormGenerator( double mean_ = 0.0 , double sd_ = 1.0 ) :
-				mean(mean_), sd(sd_) {}
+			NormGenerator_Impl( double mean_ = 0.0 , double sd_ = 1.0, const RNG& rng_ = RNG() ) :
+				mean(mean_), sd(sd_), rng(rng_) {}
 
 			inline double operator()() const {
-				return mean + sd * ::norm_rand() ;
+				return mean + sd * rng.norm_rand() ;
 			}
 
 		private:
 			double mean ;
 			double sd ;
+			RNG rng ;
 		} ;
+		typedef NormGenerator_Impl<RGlobalRNG> NormGenerator ;
 
 
 
@@ -26,22 +26,25 @@ namespace Rcpp {
 	namespace stats {
 
 
-		class UnifGenerator : public ::Rcpp::Generator<double> {
+		template <typename RNG>
+		class UnifGenerator_Impl : public ::Rcpp::Generator<double,RNG> {
 		public:
 
-			UnifGenerator( double min_ = 0.0, double max_ = 1.0) :
-				min(min_), diff(max_ - min_) {}
+			UnifGenerator_Impl( double min_ = 0.0, double max_ = 1.0, const RNG& rng_ = RNG() ) :
+				min(min_), diff(max_ - min_), rng(rng_) {}
 
 			inline double operator()() const {
 				double u;
-				do {u = unif_rand();} while (u <= 0 || u >= 1);
+				do {u = rng.unif_rand();} while (u <= 0 || u >= 1);
 				return min + diff * u;
 			}
 
 		private:
 			double min;
 			double diff ;
+			RNG rng ;
 		} ;
+		typedef UnifGenerator_Impl<RGlobalRNG> UnifGenerator ;
 
 
 		class UnifGenerator__0__1 : public ::Rcpp::Generator<double> {
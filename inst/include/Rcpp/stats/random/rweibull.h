@@ -26,19 +26,22 @@ namespace Rcpp {
 	namespace stats {
 
 
-		class WeibullGenerator : public ::Rcpp::Generator<double> {
+		template <typename RNG>
+		class WeibullGenerator_Impl : public ::Rcpp::Generator<double,RNG> {
 		public:
 
-			WeibullGenerator( double shape_, double scale_ ) :
-				shape_inv( 1/shape_), scale(scale_) {}
+			WeibullGenerator_Impl( double shape_, double scale_, const RNG& rng_ = RNG() ) :
+				shape_inv( 1/shape_), scale(scale_), rng(rng_) {}
 
 			inline double operator()() const {
-				return scale * ::R_pow(-::log(unif_rand()), shape_inv );
+				return scale * ::R_pow(-::log(rng.unif_rand()), shape_inv );
 			}
 
 		private:
 			double shape_inv, scale ;
+			RNG rng ;
 		} ;
+		typedef WeibullGenerator_Impl<RGlobalRNG> WeibullGenerator ;
 
 
 		class WeibullGenerator__scale1 : public ::Rcpp::Generator<double> {
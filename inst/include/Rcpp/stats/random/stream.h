@@ -0,0 +1,218 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// stream.h: Rcpp R/C++ interface class library -- independent random streams
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__stats__random_stream_h
+#define Rcpp__stats__random_stream_h
+
+#include <stdint.h>
+#include <vector>
+
+namespace Rcpp{
+
+/**
+ * A xoshiro256** generator, owned by the code using it rather than
+ * shared like the generator of R, so that threads can draw numbers
+ * without touching R.
+ *
+ * The stream (seed, index) starts 2^128 draws after the stream
+ * (seed, index - 1), so streams with different indices do not overlap
+ * in practice. Giving one stream to each chunk of work, rather than to
+ * each thread, makes results independent of the number of threads.
+ *
+ * The constructor makes index jumps, each costing about 256 draws, so
+ * the streams of many chunks are made by streams(), which derives each
+ * one from the previous one with a single jump:
+ *
+ *     // in the main thread
+ *     std::vector<RandomStream> streams =
+ *         RandomStream::streams( RandomStream::seed_from_R(), n_chunks ) ;
+ *     #pragma omp parallel for
+ *     for( int chunk=0; chunk<n_chunks; chunk++){
+ *         stats::NormGenerator_Impl<StreamRNG> gen( 0.0, 1.0, streams[chunk] ) ;
+ *         for( int i=start[chunk]; i<end[chunk]; i++) out[i] = gen() ;
+ *     }
+ */
+class RandomStream {
+public:
+
+    RandomStream( uint64_t seed = 0, int index = 0 ) : has_spare(false), spare(0.0) {
+        // splitmix64 spreads the seed over the state
+        for( int i=0; i<4; i++){
+            seed += u64( 0x9E3779B9u, 0x7F4A7C15u ) ;
+            uint64_t z = seed ;
+            z = ( z ^ ( z >> 30 ) ) * u64( 0xBF58476Du, 0x1CE4E5B9u ) ;
+            z = ( z ^ ( z >> 27 ) ) * u64( 0x94D049BBu, 0x133111EBu ) ;
+            s[i] = z ^ ( z >> 31 ) ;
+        }
+        for( int i=0; i<index; i++) jump() ;
+    }
+
+    /**
+     * the streams (seed, 0) to (seed, n - 1), in linear time
+     */
+    static std::vector<RandomStream> streams( uint64_t seed, int n ){
+        std::vector<RandomStream> res ;
+        if( n <= 0 ) return res ;
+        res.reserve( n ) ;
+        res.push_back( RandomStream( seed ) ) ;
+        for( int i=1; i<n; i++){
+            res.push_back( res.back() ) ;
+            res.back().jump() ;
+        }
+        return res ;
+    }
+
+    /**
+     * a seed drawn from the generator of R, so that set.seed() controls
+     * the streams. Must be called from the main thread.
+     */
+    static uint64_t seed_from_R(){
+        RNGScope scope ;
+        uint64_t hi = static_cast<uint64_t>( ::unif_rand() * 4294967296.0 ) ;
+        uint64_t lo = static_cast<uint64_t>( ::unif_rand() * 4294967296.0 ) ;
+        return ( hi << 32 ) ^ lo ;
+    }
+
+    inline uint64_t next(){
+        uint64_t result = rotl( s[1] * 5, 7 ) * 9 ;
+        uint64_t t = s[1] << 17 ;
+        s[2] ^= s[0] ;
+        s[3] ^= s[1] ;
+        s[1] ^= s[2] ;
+        s[0] ^= s[3] ;
+        s[2] ^= t ;
+        s[3] = rotl( s[3], 45 ) ;
+        return result ;
+    }
+
+    /**
+     * advances the stream by 2^128 draws
+     */
+    void jump(){
+        const uint64_t coefs[] = {
+            u64( 0x180EC6D3u, 0x3CFD0ABAu ), u64( 0xD5A61266u, 0xF0C9392Cu ),
+            u64( 0xA9582618u, 0xE03FC9AAu ), u64( 0x39ABDC45u, 0x29B1661Cu )
+        } ;
+        uint64_t t[4] = { 0, 0, 0, 0 } ;
+        for( int i=0; i<4; i++){
+            for( int b=0; b<64; b++){
+                if( coefs[i] & ( static_cast<uint64_t>(1) << b ) ){
+                    for( int j=0; j<4; j++) t[j] ^= s[j] ;
+                }
+                next() ;
+            }
+        }
+        for( int j=0; j<4; j++) s[j] = t[j] ;
+        has_spare = false ;
+    }
+
+    /**
+     * uniform on (0,1), with 53 random bits
+     */
+    inline double unif_rand(){
+        return ( static_cast<double>( next() >> 11 ) + 0.5 ) * ( 1.0 / 9007199254740992.0 ) ;
+    }
+
+    /**
+     * standard normal, by Marsaglia's polar method
+     */
+    inline double norm_rand(){
+        if( has_spare ){
+            has_spare = false ;
+            return spare ;
+        }
+        double u, v, r ;
+        do {
+            u = 2.0 * unif_rand() - 1.0 ;
+            v = 2.0 * unif_rand() - 1.0 ;
+            r = u * u + v * v ;
+        } while( r >= 1.0 || r == 0.0 ) ;
+        double f = ::sqrt( -2.0 * ::log( r ) / r ) ;
+        spare = v * f ;
+        has_spare = true ;
+        return u * f ;
+    }
+
+    /**
+     * standard exponential
+     */
+    inline double exp_rand(){
+        return -::log( unif_rand() ) ;
+    }
+
+    /**
+     * gamma, by Marsaglia and Tsang's method. a must be positive
+     */
+    inline double gamma_rand( double a, double scale ){
+        if( a < 1.0 ){
+            double u = unif_rand() ;
+            return gamma_rand( 1.0 + a, scale ) * ::pow( u, 1.0 / a ) ;
+        }
+        double d = a - 1.0 / 3.0, c = 1.0 / ::sqrt( 9.0 * d ) ;
+        for( ;; ){
+            double x, v ;
+            do {
+                x = norm_rand() ;
+                v = 1.0 + c * x ;
+            } while( v <= 0.0 ) ;
+            v = v * v * v ;
+            double u = unif_rand() ;
+            double x2 = x * x ;
+            if( u < 1.0 - 0.0331 * x2 * x2 ) return scale * d * v ;
+            if( ::log( u ) < 0.5 * x2 + d * ( 1.0 - v + ::log( v ) ) ) return scale * d * v ;
+        }
+    }
+
+private:
+
+    static inline uint64_t u64( uint32_t hi, uint32_t lo ){
+        return ( static_cast<uint64_t>( hi ) << 32 ) | lo ;
+    }
+
+    static inline uint64_t rotl( uint64_t x, int k ){
+        return ( x << k ) | ( x >> ( 64 - k ) ) ;
+    }
+
+    uint64_t s[4] ;
+    bool has_spare ;
+    double spare ;
+} ;
+
+/**
+ * RNG policy of the generators in Rcpp::stats drawing from a RandomStream.
+ * The stream is not copied, and must outlive the generators using it.
+ */
+class StreamRNG {
+public:
+    StreamRNG( RandomStream& stream_ ) : stream(&stream_){}
+
+    inline double unif_rand() const { return stream->unif_rand() ; }
+    inline double norm_rand() const { return stream->norm_rand() ; }
+    inline double exp_rand() const { return stream->exp_rand() ; }
+    inline double gamma_rand( double a, double scale ) const { return stream->gamma_rand( a, scale ) ; }
+
+private:
+    RandomStream* stream ;
+} ;
+
+}
+
+#endif
@@ -81,13 +81,48 @@ inline double qunif_0(double p /*, double a [=0.0], double b [=1.0] */, int lowe
     return R_DT_qIv(p) ;
 }
 
+// kernel of dunif, see dpq/batch.h
+class dunif_kernel {
+public:
+    dunif_kernel( bool log_ ) : a(0.0), b(1.0), log(log_) { init() ; }
+    dunif_kernel( double a_, bool log_ ) : a(a_), b(1.0), log(log_) { init() ; }
+    dunif_kernel( double a_, double b_, bool log_ ) : a(a_), b(b_), log(log_) { init() ; }
+
+    inline bool batchable() const {
+        return R_FINITE(a) && R_FINITE(b) && a < b ;
+    }
+
+    inline bool is_log() const { return log ; }
+
+    template <bool LOG>
+    inline double fast( double x, double& ok ) const {
+        ok = ( x == x ) ? 1.0 : 0.0 ;
+        return ( a <= x ) ? ( ( x <= b ) ? inside : outside ) : outside ;
+    }
+
+    inline double exact( double x ) const {
+        return ::Rf_dunif( x, a, b, log ) ;
+    }
+
+private:
+    void init(){
+        inside = log ? -::log( b - a ) : 1.0 / ( b - a ) ;
+        outside = log ? R_NegInf : 0.0 ;
+    }
+
+    double a, b, inside, outside ;
+    bool log ;
+} ;
 
 } // stats
 } // Rcpp
 
-RCPP_DPQ_0(unif, Rcpp::stats::dunif_0, Rcpp::stats::punif_0, Rcpp::stats::qunif_0 )
-RCPP_DPQ_1(unif, Rcpp::stats::dunif_1, Rcpp::stats::punif_1, Rcpp::stats::qunif_1 )
-RCPP_DPQ_2(unif, ::Rf_dunif, ::Rf_punif, ::Rf_qunif )
+RCPP_D_BATCH_0(unif, Rcpp::stats::dunif_kernel )
+RCPP_D_BATCH_1(unif, Rcpp::stats::dunif_kernel )
+RCPP_D_BATCH_2(unif, Rcpp::stats::dunif_kernel )
+RCPP_PQ_0(unif, Rcpp::stats::punif_0, Rcpp::stats::qunif_0 )
+RCPP_PQ_1(unif, Rcpp::stats::punif_1, Rcpp::stats::qunif_1 )
+RCPP_PQ_2(unif, ::Rf_punif, ::Rf_qunif )
 
 #endif
 
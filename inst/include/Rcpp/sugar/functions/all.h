@@ -33,22 +33,7 @@ public:
 	All( const VEC_TYPE& t ) : PARENT() , object(t) {}
 
 	void apply(){
-		int n = object.size() ;
-		int current = 0 ;
-		PARENT::reset() ;
-		for( int i=0 ; i<n ; i++){
-			current = object[i] ;
-			if( current == FALSE ) {
-				PARENT::set_false() ;
-				return ;
-			}
-			if( Rcpp::traits::is_na<LGLSXP>(current)  ) {
-				PARENT::set_na();
-			}
-		}
-		if( PARENT::is_unresolved() ){
-			PARENT::set_true() ;
-		}
+		PARENT::set( scan_logical( object.get_ref(), FALSE ) ) ;
 	}
 private:
 	const VEC_TYPE& object ;
@@ -64,20 +49,52 @@ public:
 	All( const VEC_TYPE& t ) : PARENT() , object(t) {}
 
 	void apply(){
-		int n = object.size() ;
-		PARENT::set_true() ;
-		for( int i=0 ; i<n ; i++){
-			if( object[i] == FALSE ) {
-				PARENT::set_false() ;
-				return ;
-			}
-		}
+		PARENT::set( scan_logical( object.get_ref(), FALSE ) ) ;
 	}
 private:
 	const VEC_TYPE& object ;
 } ;
 
 
+// comparison of a vector with a value, e.g. all( x > 0.0 ), scanning the
+// data of the vector
+template <int RTYPE, typename Operator, template <class> class StoragePolicy>
+class All< true, Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> > > :
+	public SingleLogicalResult< true, All< true, Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> > > >{
+public:
+	typedef Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> > COMPARATOR ;
+	typedef Rcpp::VectorBase<LGLSXP,true,COMPARATOR> VEC_TYPE ;
+	typedef SingleLogicalResult< true, All<true,COMPARATOR> > PARENT ;
+	All( const VEC_TYPE& t ) : PARENT() , object(t.get_ref()) {}
+
+	void apply(){
+		PARENT::set( scan_compare( object, FALSE ) ) ;
+	}
+private:
+	const COMPARATOR& object ;
+} ;
+
+// bit packed masks are scanned a word at a time
+template <>
+class All<true,LogicalMask> : public SingleLogicalResult< true, All<true,LogicalMask> >{
+public:
+	typedef Rcpp::VectorBase<LGLSXP,true,LogicalMask> VEC_TYPE ;
+	typedef SingleLogicalResult< true, All<true,LogicalMask> > PARENT ;
+	All( const VEC_TYPE& t ) : PARENT() , object(t.get_ref()) {}
+
+	void apply(){
+		if( object.has_false() ){
+			PARENT::set_false() ;
+		} else if( object.has_na() ){
+			PARENT::set_na() ;
+		} else {
+			PARENT::set_true() ;
+		}
+	}
+private:
+	const LogicalMask& object ;
+} ;
+
 } // sugar
 
 template <bool NA, typename T>
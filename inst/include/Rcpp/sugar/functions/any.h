@@ -33,22 +33,7 @@ public:
 	Any( const VEC_TYPE& t ) : PARENT() , object(t) {}
 
 	void apply(){
-		int n = object.size() ;
-		int current = 0 ;
-		PARENT::reset() ;
-		for( int i=0 ; i<n ; i++){
-			current = object[i] ;
-			if( current == TRUE ) {
-				PARENT::set_true() ;
-				return ;
-			}
-			if( Rcpp::traits::is_na<LGLSXP>(current)  ) {
-				PARENT::set_na();
-			}
-		}
-		if( PARENT::is_unresolved() ){
-			PARENT::set_false() ;
-		}
+		PARENT::set( scan_logical( object.get_ref(), TRUE ) ) ;
 	}
 private:
 	const VEC_TYPE& object ;
@@ -62,19 +47,51 @@ public:
 	Any( const VEC_TYPE& t ) : PARENT() , object(t) {}
 
 	void apply(){
-		int n = object.size() ;
-		PARENT::set_false() ;
-		for( int i=0 ; i<n ; i++){
-			if( object[i] == TRUE ) {
-				PARENT::set_true() ;
-				return ;
-			}
-		}
+		PARENT::set( scan_logical( object.get_ref(), TRUE ) ) ;
 	}
 private:
 	const VEC_TYPE& object ;
 } ;
 
+// comparison of a vector with a value, e.g. any( x > 0.0 ), scanning the
+// data of the vector
+template <int RTYPE, typename Operator, template <class> class StoragePolicy>
+class Any< true, Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> > > :
+	public SingleLogicalResult< true, Any< true, Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> > > >{
+public:
+	typedef Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> > COMPARATOR ;
+	typedef Rcpp::VectorBase<LGLSXP,true,COMPARATOR> VEC_TYPE ;
+	typedef SingleLogicalResult< true, Any<true,COMPARATOR> > PARENT ;
+	Any( const VEC_TYPE& t ) : PARENT() , object(t.get_ref()) {}
+
+	void apply(){
+		PARENT::set( scan_compare( object, TRUE ) ) ;
+	}
+private:
+	const COMPARATOR& object ;
+} ;
+
+// bit packed masks are scanned a word at a time
+template <>
+class Any<true,LogicalMask> : public SingleLogicalResult< true, Any<true,LogicalMask> >{
+public:
+	typedef Rcpp::VectorBase<LGLSXP,true,LogicalMask> VEC_TYPE ;
+	typedef SingleLogicalResult< true , Any<true,LogicalMask> > PARENT ;
+	Any( const VEC_TYPE& t ) : PARENT() , object(t.get_ref()) {}
+
+	void apply(){
+		if( object.has_true() ){
+			PARENT::set_true() ;
+		} else if( object.has_na() ){
+			PARENT::set_na() ;
+		} else {
+			PARENT::set_false() ;
+		}
+	}
+private:
+	const LogicalMask& object ;
+} ;
+
 } // sugar
 
 template <bool NA, typename T>
@@ -0,0 +1,74 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// cummin.h: Rcpp R/C++ interface class library -- cummin
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__cummin_h
+#define Rcpp__sugar__cummin_h
+
+namespace Rcpp{
+namespace sugar{
+
+template <int RTYPE> struct CumminOp ;
+
+// NaN and NA propagate, as in R
+template <> struct CumminOp<REALSXP> : public CumulativeRealState {
+	static inline double init(){ return R_PosInf ; }
+	static inline double step( double s, double x ){
+		return ( ISNAN(s) || ISNAN(x) ) ? s + x : ( s < x ? s : x ) ;
+	}
+	static inline double accumulate( double s, double x ){ return step( s, x ) ; }
+	static inline double combine( double a, double b ){ return step( a, b ) ; }
+} ;
+
+// an NA makes the rest of the result NA
+template <> struct CumminOp<INTSXP> : public CumulativeIntState {
+	static inline double init(){ return R_PosInf ; }
+	static inline double step( double s, int x ){
+		return x == NA_INTEGER ? R_NaN : combine( s, x ) ;
+	}
+	static inline double accumulate( double s, int x ){ return step( s, x ) ; }
+	static inline double combine( double a, double b ){
+		return ( ISNAN(a) || ISNAN(b) ) ? R_NaN : ( a < b ? a : b ) ;
+	}
+} ;
+
+template <int RTYPE, bool NA, typename T>
+class Cummin : public Cumulative<RTYPE,NA,T,CumminOp<RTYPE> > {
+public:
+	typedef typename Rcpp::VectorBase<RTYPE,NA,T> VEC_TYPE ;
+
+	Cummin( const VEC_TYPE& object_ ) : Cumulative<RTYPE,NA,T,CumminOp<RTYPE> >(object_){}
+} ;
+
+} // sugar
+
+template <bool NA, typename T>
+inline sugar::Cummin<INTSXP,NA,T> cummin( const VectorBase<INTSXP,NA,T>& t){
+	return sugar::Cummin<INTSXP,NA,T>( t ) ;
+}
+
+template <bool NA, typename T>
+inline sugar::Cummin<REALSXP,NA,T> cummin( const VectorBase<REALSXP,NA,T>& t){
+	return sugar::Cummin<REALSXP,NA,T>( t ) ;
+}
+
+} // Rcpp
+#endif
+
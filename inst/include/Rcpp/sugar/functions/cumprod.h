@@ -0,0 +1,65 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// cumprod.h: Rcpp R/C++ interface class library -- cumprod
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__cumprod_h
+#define Rcpp__sugar__cumprod_h
+
+namespace Rcpp{
+namespace sugar{
+
+// as in R, the result is always numeric
+template <int RTYPE> struct CumprodOp : public CumulativeRealState {
+	static inline double init(){ return 1.0 ; }
+	static inline double step( double s, double x ){ return s * x ; }
+	static inline double accumulate( double s, double x ){ return s * x ; }
+	static inline double combine( double a, double b ){ return a * b ; }
+} ;
+
+template <> struct CumprodOp<INTSXP> : public CumprodOp<REALSXP> {
+	static inline double step( double s, int x ){
+		return s * ( x == NA_INTEGER ? NA_REAL : x ) ;
+	}
+	static inline double accumulate( double s, int x ){ return step( s, x ) ; }
+} ;
+
+template <int RTYPE, bool NA, typename T>
+class Cumprod : public Cumulative<RTYPE,NA,T,CumprodOp<RTYPE> > {
+public:
+	typedef typename Rcpp::VectorBase<RTYPE,NA,T> VEC_TYPE ;
+
+	Cumprod( const VEC_TYPE& object_ ) : Cumulative<RTYPE,NA,T,CumprodOp<RTYPE> >(object_){}
+} ;
+
+} // sugar
+
+template <bool NA, typename T>
+inline sugar::Cumprod<INTSXP,NA,T> cumprod( const VectorBase<INTSXP,NA,T>& t){
+	return sugar::Cumprod<INTSXP,NA,T>( t ) ;
+}
+
+template <bool NA, typename T>
+inline sugar::Cumprod<REALSXP,NA,T> cumprod( const VectorBase<REALSXP,NA,T>& t){
+	return sugar::Cumprod<REALSXP,NA,T>( t ) ;
+}
+
+} // Rcpp
+#endif
+
@@ -25,32 +25,35 @@
 namespace Rcpp{
 namespace sugar{
 
+template <int RTYPE> struct CumsumOp ;
+
+template <> struct CumsumOp<REALSXP> : public CumulativeRealState {
+	static inline double init(){ return 0.0 ; }
+	static inline double step( double s, double x ){ return s + x ; }
+	static inline double accumulate( double s, double x ){ return s + x ; }
+	static inline double combine( double a, double b ){ return a + b ; }
+} ;
+
+// as in R, NA and integer overflow make the rest of the result NA
+template <> struct CumsumOp<INTSXP> : public CumulativeIntState {
+	static inline double init(){ return 0.0 ; }
+	static inline double step( double s, int x ){ return check( accumulate( s, x ) ) ; }
+	static inline double accumulate( double s, int x ){
+		return x == NA_INTEGER ? R_NaN : s + x ;
+	}
+	static inline double combine( double a, double b ){ return check( a + b ) ; }
+
+	static inline double check( double s ){
+		return ( s > INT_MAX || s < 1.0 + INT_MIN ) ? R_NaN : s ;
+	}
+} ;
+
 template <int RTYPE, bool NA, typename T>
-class Cumsum : public Lazy< Rcpp::Vector<RTYPE> , Cumsum<RTYPE,NA,T> > {
+class Cumsum : public Cumulative<RTYPE,NA,T,CumsumOp<RTYPE> > {
 public:
 	typedef typename Rcpp::VectorBase<RTYPE,NA,T> VEC_TYPE ;
-	typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
-	typedef Rcpp::Vector<RTYPE> VECTOR ;
 
-	Cumsum( const VEC_TYPE& object_ ) : object(object_){}
-
-	VECTOR get() const {
-	    int n = object.size() ;
-		VECTOR result( n, Rcpp::traits::get_na<RTYPE>() ) ;
-		STORAGE current = object[0] ;
-		if( Rcpp::traits::is_na<RTYPE>(current) )
-		    return result ;
-		result[0] = current ;
-		for( int i=1; i<n; i++){
-		    current = object[i] ;
-		    if( Rcpp::traits::is_na<RTYPE>(current) )
-		        return result ;
-		    result[i] = result[i-1] + current ;
-		}
-		return result ;
-	}
-private:
-	const VEC_TYPE& object ;
+	Cumsum( const VEC_TYPE& object_ ) : Cumulative<RTYPE,NA,T,CumsumOp<RTYPE> >(object_){}
 } ;
 
 } // sugar
@@ -0,0 +1,181 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// cumulative.h: Rcpp R/C++ interface class library -- scan engine for cumsum, cumprod, ...
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__cumulative_h
+#define Rcpp__sugar__cumulative_h
+
+// inputs of at least RCPP_PARALLEL_MIN_SIZE elements are scanned by
+// chunks of about this many elements, whatever the number of threads
+#ifndef RCPP_CUMULATIVE_CHUNK_SIZE
+#define RCPP_CUMULATIVE_CHUNK_SIZE 65536
+#endif
+
+namespace Rcpp{
+namespace sugar{
+
+/*
+ * A cumulative operation is described by a class OP holding a running
+ * state (OP::state_type, NaN meaning NA):
+ *
+ *   OP::init()            state before the first element
+ *   OP::step(s, x)        state after adding x, following R's rules
+ *   OP::accumulate(s, x)  same as step, without the overflow checks
+ *   OP::combine(a, b)     state reached from a through the elements that
+ *                         lead from init() to b
+ *   OP::get(s)            value stored in the result
+ *
+ * OP::rtype is the type of the result and OP::sticky_na tells whether an
+ * NA makes all the following results NA.
+ *
+ * Long inputs are scanned in two passes over chunks run in parallel
+ * (see parallel_for): totals of each chunk first, then each chunk again
+ * starting from the combined totals of the previous chunks. The chunks
+ * only depend on the length of the input, and they are used with or
+ * without OpenMP, so that double results (whose rounding depends on how
+ * the operations are grouped) are the same whatever the number of
+ * threads. They can differ in the last bits from a sequential scan.
+ */
+
+template <typename OP, typename STORAGE>
+class CumulativeTotals {
+public:
+    typedef typename OP::state_type state_type ;
+
+    CumulativeTotals( const STORAGE* in_, state_type* totals_ ) :
+        in(in_), totals(totals_){}
+
+    inline void operator()( int k, int begin, int end ) const {
+        state_type s = OP::init() ;
+        for( int i=begin; i<end; i++){
+            s = OP::accumulate( s, in[i] ) ;
+        }
+        totals[k] = s ;
+    }
+
+private:
+    const STORAGE* in ;
+    state_type* totals ;
+} ;
+
+template <typename OP, typename STORAGE, typename OUT>
+class CumulativeChunks {
+public:
+    typedef typename OP::state_type state_type ;
+
+    CumulativeChunks( const STORAGE* in_, const state_type* offsets_, OUT* out_ ) :
+        in(in_), offsets(offsets_), out(out_){}
+
+    inline void operator()( int k, int begin, int end ) const {
+        state_type s = offsets[k] ;
+        for( int i=begin; i<end; i++){
+            s = OP::step( s, in[i] ) ;
+            out[i] = OP::get( s ) ;
+        }
+    }
+
+private:
+    const STORAGE* in ;
+    const state_type* offsets ;
+    OUT* out ;
+} ;
+
+template <int RTYPE, bool NA, typename T, typename OP>
+class Cumulative : public Lazy< Rcpp::Vector<OP::rtype> , Cumulative<RTYPE,NA,T,OP> > {
+public:
+    typedef typename Rcpp::VectorBase<RTYPE,NA,T> VEC_TYPE ;
+    typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
+    typedef typename Rcpp::traits::storage_type<OP::rtype>::type OUT ;
+    typedef typename OP::state_type state_type ;
+    typedef Rcpp::Vector<OP::rtype> VECTOR ;
+
+    Cumulative( const VEC_TYPE& object_ ) : object(object_){}
+
+    VECTOR get() const {
+        // no copy when the input already is a vector
+        Rcpp::Vector<RTYPE> input( object ) ;
+        int n = input.size() ;
+        VECTOR result = no_init( n ) ;
+        if( n == 0 ) return result ;
+
+        const STORAGE* in = input.begin() ;
+        OUT* out = result.begin() ;
+        int nchunks = n < RCPP_PARALLEL_MIN_SIZE ? 1 :
+            ( n - 1 ) / RCPP_CUMULATIVE_CHUNK_SIZE + 1 ;
+        if( nchunks == 1 ){
+            state_type s = OP::init() ;
+            for( int i=0; i<n; i++){
+                s = OP::step( s, in[i] ) ;
+                out[i] = OP::get( s ) ;
+            }
+            return result ;
+        }
+
+        std::vector<state_type> totals( nchunks ), offsets( nchunks ) ;
+        internal::parallel_for( n, nchunks, CumulativeTotals<OP,STORAGE>( in, &totals[0] ) ) ;
+        offsets[0] = OP::init() ;
+        for( int k=1; k<nchunks; k++){
+            offsets[k] = OP::combine( offsets[k-1], totals[k-1] ) ;
+        }
+        internal::parallel_for( n, nchunks, CumulativeChunks<OP,STORAGE,OUT>( in, &offsets[0], out ) ) ;
+
+        // an NA that only appears while scanning a chunk (e.g. integer
+        // overflow) is not known to the chunks that follow it
+        if( OP::sticky_na ){
+            for( int k=1; k<nchunks; k++){
+                int end = internal::parallel_chunk_begin( n, nchunks, k ) ;
+                if( traits::is_na<OP::rtype>( out[end-1] ) ){
+                    std::fill( out + end, out + n, traits::get_na<OP::rtype>() ) ;
+                    break ;
+                }
+            }
+        }
+        return result ;
+    }
+
+private:
+    const VEC_TYPE& object ;
+} ;
+
+// NA/NaN propagates through the arithmetic, as in R
+struct CumulativeRealState {
+    typedef double state_type ;
+    enum { rtype = REALSXP } ;
+    static const bool sticky_na = false ;
+
+    static inline double get( double s ){ return s ; }
+} ;
+
+// integer results: the state is a double so that overflow can be
+// detected, NaN stands for NA and is kept until the end
+struct CumulativeIntState {
+    typedef double state_type ;
+    enum { rtype = INTSXP } ;
+    static const bool sticky_na = true ;
+
+    static inline int get( double s ){
+        return ISNAN(s) ? NA_INTEGER : static_cast<int>( s ) ;
+    }
+} ;
+
+} // sugar
+} // Rcpp
+
+#endif
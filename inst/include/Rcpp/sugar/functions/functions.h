@@ -31,6 +31,7 @@
 
 #include <Rcpp/sugar/functions/complex.h>
 
+#include <Rcpp/sugar/functions/scan_logical.h>
 #include <Rcpp/sugar/functions/any.h>
 #include <Rcpp/sugar/functions/all.h>
 #include <Rcpp/sugar/functions/is_na.h>
@@ -63,11 +64,17 @@
 #include <Rcpp/sugar/functions/mean.h>
 #include <Rcpp/sugar/functions/var.h>
 #include <Rcpp/sugar/functions/sd.h>
+#include <Rcpp/sugar/functions/cumulative.h>
 #include <Rcpp/sugar/functions/cumsum.h>
+#include <Rcpp/sugar/functions/cumprod.h>
+#include <Rcpp/sugar/functions/cummin.h>
+#include <Rcpp/sugar/functions/cummax.h>
 #include <Rcpp/sugar/functions/which_min.h>
 #include <Rcpp/sugar/functions/which_max.h>
+#include <Rcpp/sugar/functions/which.h>
 
 #include <Rcpp/sugar/functions/unique.h>
+#include <Rcpp/sugar/functions/order.h>
 #include <Rcpp/sugar/functions/match.h>
 #include <Rcpp/sugar/functions/table.h>
 #include <Rcpp/sugar/functions/duplicated.h>
@@ -48,6 +48,40 @@ private:
 	Function fun ;
 } ;
 
+template <typename U, bool HAS_ITERATOR>
+struct lapply_reusable_impl : public Rcpp::traits::false_type {} ;
+
+template <typename U>
+struct lapply_reusable_impl<U,true> :
+	public Rcpp::traits::is_primitive<typename U::value_type> {} ;
+
+// containers of primitive values, e.g. std::vector<double>, can be copied
+// into an existing vector of the same type and size instead of being wrapped
+template <typename U>
+struct lapply_reusable :
+	public lapply_reusable_impl<U, Rcpp::traits::has_iterator<U>::value> {} ;
+
+template <typename U>
+inline void lapply_store( List& out, int i, const U& res, Rcpp::traits::false_type ){
+	out[i] = res ;
+}
+
+template <typename U>
+inline void lapply_store( List& out, int i, const U& res, Rcpp::traits::true_type ){
+	typedef typename U::value_type value_type ;
+	const int RT = Rcpp::traits::r_sexptype_traits<value_type>::rtype ;
+	typedef typename Rcpp::traits::storage_type<RT>::type STORAGE ;
+	SEXP elt = VECTOR_ELT( out, i ) ;
+	// an element that may be referenced from elsewhere is replaced
+	if( TYPEOF(elt) == RT && Rf_length(elt) == static_cast<int>( res.size() ) && NAMED(elt) < 2 ){
+		std::transform( res.begin(), res.end(),
+			Rcpp::internal::r_vector_start<RT>(elt),
+			Rcpp::internal::caster<value_type,STORAGE> ) ;
+	} else {
+		out[i] = res ;
+	}
+}
+
 } // sugar
 
 template <int RTYPE, bool NA, typename T, typename Function >
@@ -56,6 +90,28 @@ lapply( const Rcpp::VectorBase<RTYPE,NA,T>& t, Function fun ){
 	return sugar::Lapply<RTYPE,NA,T,Function>( t, fun ) ;
 }
 
+/**
+ * lapply writing into an existing list, typically the result of a
+ * previous call. When fun returns a container of primitive values and
+ * out[i] already is a vector of the matching type and length that is
+ * not shared (NAMED below 2), the values are copied into out[i] instead
+ * of allocating a new vector. out is resized when its length does not
+ * match the input.
+ */
+template <int RTYPE, bool NA, typename T, typename Function >
+inline void lapply_into( const Rcpp::VectorBase<RTYPE,NA,T>& t, Function fun, List& out ){
+	typedef typename ::Rcpp::traits::result_of<Function>::type result_type ;
+	typedef typename sugar::lapply_reusable<result_type>::type reusable ;
+	int n = t.size() ;
+	if( out.size() != n ){
+		out = List(n) ;
+	}
+	const T& ref = t.get_ref() ;
+	for( int i=0; i<n; i++){
+		sugar::lapply_store( out, i, fun( ref[i] ), reusable() ) ;
+	}
+}
+
 } // Rcpp
 
 #endif
@@ -0,0 +1,52 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// order.h: Rcpp R/C++ interface class library -- order, sort_index
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__order_h
+#define Rcpp__sugar__order_h
+
+namespace Rcpp{
+
+/**
+ * Stable permutation (0-based) that sorts x, with NA and NaN last
+ */
+template <int RTYPE, bool NA, typename T>
+inline IntegerVector sort_index( const VectorBase<RTYPE,NA,T>& x ){
+    Vector<RTYPE> vec( x ) ;
+    int n = vec.size() ;
+    IntegerVector index = no_init( n ) ;
+    internal::radix_order( internal::r_vector_start<RTYPE>( vec ), n, index.begin() ) ;
+    return index ;
+}
+
+/**
+ * Same as sort_index but 1-based, as R's order
+ */
+template <int RTYPE, bool NA, typename T>
+inline IntegerVector order( const VectorBase<RTYPE,NA,T>& x ){
+    IntegerVector index = sort_index( x ) ;
+    int* p = index.begin() ;
+    for( int i=0, n=index.size(); i<n; i++) p[i]++ ;
+    return index ;
+}
+
+} // Rcpp
+#endif
+
@@ -96,6 +96,35 @@ private:
 } ;
 
 
+// only atomic vectors can be read and filled without the R API
+template <int RTYPE> struct sapply_parallel_type ;
+template <> struct sapply_parallel_type<INTSXP>{} ;
+template <> struct sapply_parallel_type<REALSXP>{} ;
+template <> struct sapply_parallel_type<LGLSXP>{} ;
+template <> struct sapply_parallel_type<CPLXSXP>{} ;
+template <> struct sapply_parallel_type<RAWSXP>{} ;
+
+// each chunk calls its own copy of the function, so that functors with a
+// non const operator() can be used and threads do not share their state
+template <typename INPUT, typename Function, typename STORAGE, typename converter_type>
+class SapplyParallelBody {
+public:
+	SapplyParallelBody( const INPUT* in_, const Function& fun_, STORAGE* out_ ) :
+		in(in_), fun(fun_), out(out_){}
+
+	inline void operator()( int, int begin, int end ) const {
+		Function f( fun ) ;
+		for( int i=begin; i<end; i++){
+			out[i] = converter_type::get( f( in[i] ) ) ;
+		}
+	}
+
+private:
+	const INPUT* in ;
+	Function fun ;
+	STORAGE* out ;
+} ;
+
 } // sugar
 
 template <int RTYPE, bool NA, typename T, typename Function >
@@ -114,6 +143,39 @@ sapply( const Rcpp::VectorBase<RTYPE,NA,T>& t, Function fun ){
     >::value >( t, fun ) ;
 }
 
+/**
+ * Same as sapply but for functions returning a primitive value: results
+ * are written straight into the returned vector, and the index range is
+ * split across threads when compiled with OpenMP (see parallel_chunks).
+ * A sugar expression given as input is first evaluated into a vector,
+ * on the calling thread, as its elements may need the R API.
+ *
+ * fun is copied for each chunk, and the copies are called concurrently:
+ * they must not use the R API nor throw.
+ */
+template <int RTYPE, bool NA, typename T, typename Function >
+inline Vector< traits::r_sexptype_traits< typename ::Rcpp::traits::result_of<Function>::type >::rtype >
+sapply_parallel( const Rcpp::VectorBase<RTYPE,NA,T>& t, Function fun ){
+	typedef typename ::Rcpp::traits::result_of<Function>::type result_type ;
+	const int RESULT_R_TYPE = traits::r_sexptype_traits<result_type>::rtype ;
+	typedef typename traits::storage_type<RESULT_R_TYPE>::type STORAGE ;
+	typedef typename traits::r_vector_element_converter<RESULT_R_TYPE>::type converter_type ;
+	typedef typename traits::storage_type<RTYPE>::type INPUT ;
+
+	// compile time checks that input and output are atomic vectors
+	sugar::sapply_parallel_type<RTYPE> input_check ; (void)input_check ;
+	sugar::sapply_parallel_type<RESULT_R_TYPE> output_check ; (void)output_check ;
+
+	// shares the data when t is already a Vector<RTYPE>
+	Vector<RTYPE> input( t ) ;
+	int n = input.size() ;
+	Vector<RESULT_R_TYPE> res = no_init(n) ;
+	sugar::SapplyParallelBody<INPUT,Function,STORAGE,converter_type> body(
+		internal::r_vector_start<RTYPE>( input ), fun, res.begin() ) ;
+	internal::parallel_for( n, internal::parallel_chunks(n), body ) ;
+	return res ;
+}
+
 } // Rcpp
 
 #endif
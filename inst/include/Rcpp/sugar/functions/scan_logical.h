@@ -0,0 +1,151 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// scan_logical.h: Rcpp R/C++ interface class library -- block scans for any and all
+//
+// Copyright (C) 2014 Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__scan_logical_h
+#define Rcpp__sugar__scan_logical_h
+
+// any() and all() stop at the first block holding a decisive element, so at
+// most RCPP_SUGAR_SCAN_BLOCK - 1 elements are evaluated for nothing
+#ifndef RCPP_SUGAR_SCAN_BLOCK
+#define RCPP_SUGAR_SCAN_BLOCK 128
+#endif
+
+namespace Rcpp{
+namespace sugar{
+
+	/**
+	 * Scans a logical expression by blocks, checking the elements of a
+	 * block without branches. Gives decisive (TRUE for any, FALSE for all) as soon as a
+	 * block contains it, otherwise NA if some element was NA, otherwise
+	 * the opposite of decisive.
+	 */
+	template <typename T>
+	int scan_logical( const T& object, int decisive ){
+		int n = object.size() ;
+		int na = 0 ;
+		for( int start=0; start<n; start += RCPP_SUGAR_SCAN_BLOCK ){
+			int end = std::min( start + RCPP_SUGAR_SCAN_BLOCK, n ) ;
+			int hit = 0 ;
+			for( int i=start; i<end; i++){
+				int current = object[i] ;
+				hit |= current == decisive ;
+				na  |= current == NA_LOGICAL ;
+			}
+			if( hit ) return decisive ;
+		}
+		return na ? NA_LOGICAL : !decisive ;
+	}
+
+	// NA test without call, so that the loops below vectorize
+	template <int RTYPE>
+	inline int scan_is_na( typename traits::storage_type<RTYPE>::type x ){
+		return traits::is_na<RTYPE>(x) ;
+	}
+	template <>
+	inline int scan_is_na<REALSXP>( double x ){ return x != x ; }
+	template <>
+	inline int scan_is_na<INTSXP>( int x ){ return x == NA_INTEGER ; }
+	template <>
+	inline int scan_is_na<LGLSXP>( int x ){ return x == NA_LOGICAL ; }
+
+	// m logical values: whether one is decisive, na is set if one is NA
+	inline int scan_logical_block( const int* x, int m, int decisive, int& na ){
+		int hit = 0, has_na = 0 ;
+		for( int k=0; k<m; k++){
+			hit    |= x[k] == decisive ;
+			has_na |= x[k] == NA_LOGICAL ;
+		}
+		na |= has_na ;
+		return hit ;
+	}
+
+	// m values compared to rhs: whether a comparison is decisive
+	template <int RTYPE, typename Operator>
+	inline int scan_compare_block( const typename traits::storage_type<RTYPE>::type* x, int m,
+		typename traits::storage_type<RTYPE>::type rhs, int decisive, int& na ){
+		Operator op ;
+		int hit = 0, has_na = 0 ;
+		for( int k=0; k<m; k++){
+			int is_na = scan_is_na<RTYPE>( x[k] ) ;
+			hit    |= ( op( x[k], rhs ) == decisive ) & !is_na ;
+			has_na |= is_na ;
+		}
+		na |= has_na ;
+		return hit ;
+	}
+
+	// full blocks are given a constant size, so that the compiler
+	// vectorizes them even at -O2
+	template <template <class> class StoragePolicy>
+	int scan_logical( const Vector<LGLSXP,StoragePolicy>& object, int decisive ){
+		const int* x = internal::r_vector_start<LGLSXP>( object ) ;
+		int n = object.size() ;
+		int na = 0, start = 0 ;
+		for( ; start + RCPP_SUGAR_SCAN_BLOCK <= n; start += RCPP_SUGAR_SCAN_BLOCK ){
+			if( scan_logical_block( x + start, RCPP_SUGAR_SCAN_BLOCK, decisive, na ) ) return decisive ;
+		}
+		if( scan_logical_block( x + start, n - start, decisive, na ) ) return decisive ;
+		return na ? NA_LOGICAL : !decisive ;
+	}
+
+	/**
+	 * The same scan for the comparison of the contiguous data of a vector
+	 * with a single value, e.g. any( x > 0.0 ), without going through
+	 * Comparator_With_One_Value::operator[]
+	 */
+	template <int RTYPE, typename Operator>
+	int scan_compare( const typename traits::storage_type<RTYPE>::type* x, int n,
+		typename traits::storage_type<RTYPE>::type rhs, int decisive ){
+		if( n == 0 ) return !decisive ;
+		if( scan_is_na<RTYPE>(rhs) ) return NA_LOGICAL ;
+		int na = 0, start = 0 ;
+		for( ; start + RCPP_SUGAR_SCAN_BLOCK <= n; start += RCPP_SUGAR_SCAN_BLOCK ){
+			if( scan_compare_block<RTYPE,Operator>( x + start, RCPP_SUGAR_SCAN_BLOCK, rhs, decisive, na ) ) return decisive ;
+		}
+		if( scan_compare_block<RTYPE,Operator>( x + start, n - start, rhs, decisive, na ) ) return decisive ;
+		return na ? NA_LOGICAL : !decisive ;
+	}
+
+	template <int RTYPE, typename Operator, template <class> class StoragePolicy>
+	inline int scan_compare__impl( const Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> >& object,
+		int decisive, traits::false_type ){
+		return scan_logical( object, decisive ) ;
+	}
+
+	template <int RTYPE, typename Operator, template <class> class StoragePolicy>
+	inline int scan_compare__impl( const Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> >& object,
+		int decisive, traits::true_type ){
+		return scan_compare<RTYPE,Operator>( internal::r_vector_start<RTYPE>( object.get_lhs().get_ref() ),
+			object.size(), object.get_rhs(), decisive ) ;
+	}
+
+	// vector compared to a value: uses the data directly when the vector
+	// gives access to it
+	template <int RTYPE, typename Operator, template <class> class StoragePolicy>
+	inline int scan_compare( const Comparator_With_One_Value<RTYPE,Operator,true,Vector<RTYPE,StoragePolicy> >& object,
+		int decisive ){
+		return scan_compare__impl( object, decisive,
+			typename traits::r_vector_direct_access<RTYPE>::type() ) ;
+	}
+
+} // sugar
+} // Rcpp
+#endif
@@ -25,46 +25,41 @@
 namespace Rcpp{
 namespace sugar{
 
-    template <typename SET>
-    class RemoveFromSet {
-    public:
-        RemoveFromSet( SET& set_) : set(set_){}
-
-        template <typename T>
-        void operator()(T value){
-            set.erase( value );
-        }
-
-    private:
-        SET& set ;
-    } ;
+    /*
+     * The set operations hash the distinct values of the left hand side
+     * (IndexHash), and give their result in the order of the first
+     * occurrences, as R does.
+     */
 
     template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
     class SetDiff {
     public:
         typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 
-        SetDiff( const LHS_T& lhs, const RHS_T& rhs) :
-            lhs_set( get_const_begin(lhs), get_const_end(lhs) ),
-            rhs_set( get_const_begin(rhs), get_const_end(rhs) )
-        {
-
-            std::for_each( rhs_set.begin(), rhs_set.end(), RemoveFromSet<SET>(lhs_set) ) ;
-        }
+        SetDiff( const LHS_T& lhs, const RHS_T& rhs) : x(lhs), y(rhs){}
 
         Vector<RTYPE> get() const {
-            int n = lhs_set.size() ;
-            Vector<RTYPE> out = no_init(n) ;
-            std::copy( lhs_set.begin(), lhs_set.end(), get_const_begin(out) ) ;
+            IndexHash<RTYPE> hash(x) ;
+            std::vector<int> first = hash.fill_and_get_first() ;
+
+            std::vector<bool> drop( x.size(), false ) ;
+            const STORAGE* py = internal::r_vector_start<RTYPE>(y) ;
+            for( int i=0, n=y.size(); i<n; i++){
+                int index = hash.get_index( py[i] ) ;
+                if( index != NA_INTEGER ) drop[index-1] = true ;
+            }
+
+            int n = first.size() ;
+            Vector<RTYPE> out = no_init( n - std::count( drop.begin(), drop.end(), true ) ) ;
+            for( int i=0, j=0; i<n; i++){
+                if( !drop[first[i]] ) out[j++] = x[first[i]] ;
+            }
             return out ;
         }
 
     private:
-        typedef RCPP_UNORDERED_SET<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET lhs_set ;
-        SET rhs_set ;
-
+        Vector<RTYPE> x ;
+        Vector<RTYPE> y ;
     } ;
 
     template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
@@ -72,30 +67,29 @@ namespace sugar{
     public:
         typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 
-        SetEqual( const LHS_T& lhs, const RHS_T& rhs) :
-            lhs_set( get_const_begin(lhs), get_const_end(lhs) ),
-            rhs_set( get_const_begin(rhs), get_const_end(rhs) )
-        {
-
-            std::for_each( rhs_set.begin(), rhs_set.end(), RemoveFromSet<SET>(lhs_set) ) ;
-        }
+        SetEqual( const LHS_T& lhs, const RHS_T& rhs) : x(lhs), y(rhs){}
 
         bool get() const {
-            if( lhs_set.size() != rhs_set.size() ) return false ;
-
-            ITERATOR it = lhs_set.begin(), end = lhs_set.end(), rhs_end = rhs_set.end() ;
-            for( ; it != end; ){
-                if( rhs_set.find(*it++) == rhs_end ) return false ;
+            IndexHash<RTYPE> hash(x) ;
+            hash.fill() ;
+
+            std::vector<bool> found( x.size(), false ) ;
+            int nfound = 0 ;
+            const STORAGE* py = internal::r_vector_start<RTYPE>(y) ;
+            for( int i=0, n=y.size(); i<n; i++){
+                int index = hash.get_index( py[i] ) ;
+                if( index == NA_INTEGER ) return false ;
+                if( !found[index-1] ){
+                    found[index-1] = true ;
+                    nfound++ ;
+                }
             }
-            return true ;
+            return nfound == hash.size() ;
         }
 
     private:
-        typedef RCPP_UNORDERED_SET<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET lhs_set ;
-        SET rhs_set ;
-
+        Vector<RTYPE> x ;
+        Vector<RTYPE> y ;
     } ;
 
     template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
@@ -103,32 +97,30 @@ namespace sugar{
     public:
         typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 
-        Intersect( const LHS_T& lhs, const RHS_T& rhs) :
-            intersect()
-        {
+        Intersect( const LHS_T& lhs, const RHS_T& rhs) : x(lhs), y(rhs){}
 
-            SET lhs_set( get_const_begin(lhs), get_const_end(lhs) ) ;
-            SET rhs_set( get_const_begin(rhs), get_const_end(rhs) ) ;
-
-            ITERATOR end = lhs_set.end() ;
-            ITERATOR rhs_end = rhs_set.end() ;
-            for( ITERATOR it=lhs_set.begin(); it != end; it++){
-                if( rhs_set.find(*it) != rhs_end ) intersect.insert(*it) ;
+        Vector<RTYPE> get() const {
+            IndexHash<RTYPE> hash(x) ;
+            std::vector<int> first = hash.fill_and_get_first() ;
+
+            std::vector<bool> keep( x.size(), false ) ;
+            const STORAGE* py = internal::r_vector_start<RTYPE>(y) ;
+            for( int i=0, n=y.size(); i<n; i++){
+                int index = hash.get_index( py[i] ) ;
+                if( index != NA_INTEGER ) keep[index-1] = true ;
             }
-        }
 
-        Vector<RTYPE> get() const {
-            int n = intersect.size() ;
-            Vector<RTYPE> out = no_init(n) ;
-            std::copy( intersect.begin(), intersect.end(), get_const_begin(out) ) ;
+            int n = first.size() ;
+            Vector<RTYPE> out = no_init( std::count( keep.begin(), keep.end(), true ) ) ;
+            for( int i=0, j=0; i<n; i++){
+                if( keep[first[i]] ) out[j++] = x[first[i]] ;
+            }
             return out ;
         }
 
     private:
-        typedef RCPP_UNORDERED_SET<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET intersect ;
-
+        Vector<RTYPE> x ;
+        Vector<RTYPE> y ;
     } ;
 
     template <int RTYPE, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T>
@@ -136,24 +128,29 @@ namespace sugar{
     public:
         typedef typename Rcpp::traits::storage_type<RTYPE>::type STORAGE ;
 
-        Union( const LHS_T& lhs, const RHS_T& rhs) :
-            result( get_const_begin(lhs), get_const_end(lhs) )
-        {
-            result.insert( get_const_begin(rhs), get_const_end(rhs) ) ;
-        }
+        Union( const LHS_T& lhs, const RHS_T& rhs) : x(lhs), y(rhs){}
 
+        // unique( c(x, y) )
         Vector<RTYPE> get() const {
-            int n = result.size() ;
-            Vector<RTYPE> out = no_init(n) ;
-            std::copy( result.begin(), result.end(), get_const_begin(out) ) ;
+            int nx = x.size(), ny = y.size() ;
+            Vector<RTYPE> both = no_init( nx + ny ) ;
+            std::copy( x.begin(), x.end(), both.begin() ) ;
+            std::copy( y.begin(), y.end(), both.begin() + nx ) ;
+
+            IndexHash<RTYPE> hash(both) ;
+            std::vector<int> first = hash.fill_and_get_first() ;
+
+            int n = first.size() ;
+            Vector<RTYPE> out = no_init( n ) ;
+            for( int i=0; i<n; i++){
+                out[i] = both[first[i]] ;
+            }
             return out ;
         }
 
     private:
-        typedef RCPP_UNORDERED_SET<STORAGE> SET ;
-        typedef typename SET::const_iterator ITERATOR ;
-        SET result ;
-
+        Vector<RTYPE> x ;
+        Vector<RTYPE> y ;
     } ;
 
 
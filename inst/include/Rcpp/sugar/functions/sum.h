@@ -92,6 +92,21 @@ private:
 	const VEC_EXT& object ;
 } ;
 
+// bit packed masks: population count of the words
+template <>
+class Sum<LGLSXP,true,LogicalMask> : public Lazy< int , Sum<LGLSXP,true,LogicalMask> > {
+public:
+	typedef Rcpp::VectorBase<LGLSXP,true,LogicalMask> VEC_TYPE ;
+
+	Sum( const VEC_TYPE& object_ ) : object(object_.get_ref()){}
+
+	int get() const {
+		return object.has_na() ? NA_INTEGER : object.count() ;
+	}
+private:
+	const LogicalMask& object ;
+} ;
+
 } // sugar
 
 template <bool NA, typename T>
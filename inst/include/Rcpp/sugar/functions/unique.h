@@ -79,6 +79,12 @@ inline LogicalVector in( const VectorBase<RTYPE,NA,T>& x, const VectorBase<RTYPE
     return sugar::In<RTYPE, TABLE_T>(table).get( x.get_ref() ) ;
 }
 
+// same as in, as x %in% table in R
+template <int RTYPE, bool NA, typename T, bool RHS_NA, typename RHS_T>
+inline LogicalVector is_in( const VectorBase<RTYPE,NA,T>& x, const VectorBase<RTYPE,RHS_NA,RHS_T>& table ){
+    return in( x, table ) ;
+}
+
 
 } // Rcpp
 #endif
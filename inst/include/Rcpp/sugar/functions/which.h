@@ -0,0 +1,125 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; tab-width: 8 -*-
+//
+// which.h: Rcpp R/C++ interface class library -- which
+//
+// Copyright (C) 2014   Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp__sugar__which_h
+#define Rcpp__sugar__which_h
+
+namespace Rcpp{
+namespace sugar{
+
+    struct which_fill {
+        which_fill( int* out_, int offset_ ) : out(out_), offset(offset_){}
+        inline void operator()( int i ){ *out++ = i + offset ; }
+        int* out ;
+        int offset ;
+    } ;
+
+    /*
+     * which() of a logical vector makes two passes over chunks run in
+     * parallel (see parallel_for): the number of TRUE elements of each
+     * chunk first, then each chunk writes its positions from the sum of
+     * the counts of the previous chunks
+     */
+    class WhichCount {
+    public:
+        WhichCount( const int* in_, int* counts_ ) : in(in_), counts(counts_){}
+
+        inline void operator()( int k, int begin, int end ) const {
+            int count = 0 ;
+            for( int i=begin; i<end; i++){
+                count += in[i] == TRUE ;
+            }
+            counts[k] = count ;
+        }
+
+    private:
+        const int* in ;
+        int* counts ;
+    } ;
+
+    class WhichFill {
+    public:
+        WhichFill( const int* in_, const int* offsets_, int* out_, int base_ ) :
+            in(in_), offsets(offsets_), out(out_), base(base_){}
+
+        inline void operator()( int k, int begin, int end ) const {
+            int* p = out + offsets[k] ;
+            int* last = out + offsets[k+1] ;
+            // each position is written, and kept when the element is TRUE.
+            // This stops when the chunk has all its positions, so that
+            // nothing is written past them
+            for( int i=begin; i<end && p<last; i++){
+                *p = i + base ;
+                p += in[i] == TRUE ;
+            }
+        }
+
+    private:
+        const int* in ;
+        const int* offsets ;
+        int* out ;
+        int base ;
+    } ;
+
+} // sugar
+
+/**
+ * positions of the TRUE elements of a logical vector or sugar expression,
+ * NA elements are not selected. Positions start at 0, or at 1 as in R
+ * when one_based is true.
+ *
+ * The expression is evaluated once into a logical vector (no copy when
+ * it already is one), which is then read twice: once to count the TRUE
+ * elements, and once to fill the result allocated from the count.
+ */
+template <bool NA, typename T>
+inline IntegerVector which( const VectorBase<LGLSXP,NA,T>& t, bool one_based = false ){
+    LogicalVector input( t ) ;
+    int n = input.size() ;
+    const int* in = input.begin() ;
+
+    int nchunks = internal::parallel_chunks( n ) ;
+    std::vector<int> counts( nchunks ), offsets( nchunks + 1 ) ;
+    internal::parallel_for( n, nchunks, sugar::WhichCount( in, &counts[0] ) ) ;
+    offsets[0] = 0 ;
+    for( int k=0; k<nchunks; k++){
+        offsets[k+1] = offsets[k] + counts[k] ;
+    }
+
+    IntegerVector res = no_init( offsets[nchunks] ) ;
+    internal::parallel_for( n, nchunks,
+        sugar::WhichFill( in, &offsets[0], res.begin(), one_based ? 1 : 0 ) ) ;
+    return res ;
+}
+
+/**
+ * positions of the TRUE elements of the mask, NA elements are not
+ * selected. Positions start at 0, or at 1 as in R when one_based is true
+ */
+inline IntegerVector which( const LogicalMask& mask, bool one_based = false ){
+    IntegerVector res = no_init( mask.count() ) ;
+    sugar::which_fill fill( res.begin(), one_based ? 1 : 0 ) ;
+    mask.for_each_true( fill ) ;
+    return res ;
+}
+
+} // Rcpp
+#endif
@@ -22,9 +22,43 @@
 #ifndef Rcpp__sugar__outer_h
 #define Rcpp__sugar__outer_h
 
+// number of rows of the result filled for all columns before moving on,
+// so that the corresponding block of lhs stays in cache
+#ifndef RCPP_OUTER_BLOCK_SIZE
+#define RCPP_OUTER_BLOCK_SIZE 2048
+#endif
+
 namespace Rcpp{
 namespace sugar{
 
+// fills columns [begin,end) of the column major result from plain arrays
+template <typename INPUT, typename STORAGE, typename Function, typename converter_type>
+class OuterKernel {
+public:
+    OuterKernel( const INPUT* x_, int nr_, const INPUT* y_, const Function& fun_, STORAGE* out_ ) :
+        x(x_), nr(nr_), y(y_), fun(fun_), out(out_){}
+
+    inline void operator()( int, int begin, int end ) const {
+        for( int i0=0; i0<nr; i0 += RCPP_OUTER_BLOCK_SIZE ){
+            int i1 = std::min( i0 + RCPP_OUTER_BLOCK_SIZE, nr ) ;
+            for( int j=begin; j<end; j++ ){
+                const INPUT yj = y[j] ;
+                STORAGE* col = out + static_cast<R_xlen_t>(j) * nr ;
+                for( int i=i0; i<i1; i++ ){
+                    col[i] = converter_type::get( fun( x[i], yj ) ) ;
+                }
+            }
+        }
+    }
+
+private:
+    const INPUT* x ;
+    int nr ;
+    const INPUT* y ;
+    const Function& fun ;
+    STORAGE* out ;
+} ;
+
 template <int RTYPE,
           bool LHS_NA, typename LHS_T,
           bool RHS_NA, typename RHS_T,
@@ -61,8 +95,41 @@ public:
     inline int nrow() const { return nr; }
     inline int ncol() const { return nc; }
 
+    // writes the whole result into m, which has the right dimensions.
+    // When inputs and result are plain vectors the values are first
+    // copied into arrays and the matrix is filled block by block, with
+    // columns split across nchunks threads (see parallel_for)
+    template <typename MAT>
+    inline void import_into( MAT& m, int nchunks ) const {
+        import_into__impl( m, nchunks, typename traits::both<
+            traits::r_vector_direct_access<RTYPE>,
+            traits::r_vector_direct_access<RESULT_R_TYPE>
+        >::type() ) ;
+    }
+
 private:
 
+    template <typename MAT>
+    inline void import_into__impl( MAT& m, int, traits::false_type ) const {
+        typename MAT::iterator start = m.begin() ;
+        for( int j=0; j<nc; j++){
+            for( int i=0; i<nr; i++, ++start){
+                *start = operator()(i,j) ;
+            }
+        }
+    }
+
+    template <typename MAT>
+    inline void import_into__impl( MAT& m, int nchunks, traits::true_type ) const {
+        typedef typename traits::storage_type<RTYPE>::type INPUT ;
+        if( nr == 0 || nc == 0 ) return ;
+        std::vector<INPUT> x(nr), y(nc) ;
+        for( int i=0; i<nr; i++) x[i] = lhs[i] ;
+        for( int j=0; j<nc; j++) y[j] = rhs[j] ;
+        OuterKernel<INPUT,STORAGE,Function,converter_type> kernel( &x[0], nr, &y[0], fun, m.begin() ) ;
+        internal::parallel_for( nc, nchunks, kernel ) ;
+    }
+
     LHS_LAZY lhs ;
     RHS_LAZY rhs ;
 
@@ -85,6 +152,31 @@ outer(
     return sugar::Outer<RTYPE,LHS_NA,LHS_T,RHS_NA,RHS_T,Function>( lhs, rhs, fun ) ;
 }
 
+/**
+ * Same as outer but evaluated right away, splitting the columns of the
+ * result across threads when compiled with OpenMP (see parallel_chunks).
+ *
+ * fun is called concurrently and must not use the R API nor throw.
+ * Character and list inputs are always processed serially.
+ */
+template <int RTYPE,
+          bool LHS_NA, typename LHS_T,
+          bool RHS_NA, typename RHS_T,
+          typename Function >
+inline Matrix< traits::r_sexptype_traits< typename ::Rcpp::traits::result_of<Function>::type >::rtype >
+outer_parallel(
+      const Rcpp::VectorBase<RTYPE,LHS_NA,LHS_T>& lhs,
+      const Rcpp::VectorBase<RTYPE,RHS_NA,RHS_T>& rhs,
+      Function fun ){
+
+    typedef sugar::Outer<RTYPE,LHS_NA,LHS_T,RHS_NA,RHS_T,Function> OUTER ;
+    OUTER expr( lhs, rhs, fun ) ;
+    Matrix<OUTER::RESULT_R_TYPE> res( Rf_allocMatrix( OUTER::RESULT_R_TYPE, expr.nrow(), expr.ncol() ) ) ;
+    int nchunks = internal::parallel_chunks( static_cast<R_xlen_t>( expr.nrow() ) * expr.ncol() ) ;
+    expr.import_into( res, std::min( nchunks, expr.ncol() ) ) ;
+    return res ;
+}
+
 } // Rcpp
 
 #endif
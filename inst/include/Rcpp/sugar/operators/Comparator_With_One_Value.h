@@ -47,6 +47,9 @@ public:
 
 	inline int size() const { return lhs.size() ; }
 
+	inline const VEC_TYPE& get_lhs() const { return lhs ; }
+	inline STORAGE get_rhs() const { return rhs ; }
+
 private:
 	const VEC_TYPE& lhs ;
 	STORAGE rhs ;
@@ -86,6 +89,9 @@ public:
 
 	inline int size() const { return lhs.size() ; }
 
+	inline const VEC_TYPE& get_lhs() const { return lhs ; }
+	inline STORAGE get_rhs() const { return rhs ; }
+
 private:
 	const VEC_TYPE& lhs ;
 	STORAGE rhs ;
@@ -22,6 +22,27 @@
 
 namespace Rcpp {
 
+namespace traits {
+
+    // tells whether a list element can be used as a T as is, i.e. without
+    // going through as<T>. Only plain vectors can be decided from the
+    // SEXPTYPE alone, anything else is always converted
+    template <typename T>
+    struct list_of_element {
+        static inline bool check(SEXP) { return false; }
+    };
+
+    template <int RTYPE, template <class> class StoragePolicy>
+    struct list_of_element< Vector<RTYPE, StoragePolicy> > {
+        static inline bool check(SEXP x) { return TYPEOF(x) == RTYPE; }
+    };
+
+} // traits
+
+// tag used to ask a ListOf to convert its elements on first access
+// rather than all at once when it is constructed
+class lazy_convert {};
+
 template <typename T>
 class ListOf {
 
@@ -29,22 +50,32 @@ public:
     typedef typename traits::r_vector_iterator<VECSXP>::type iterator;
     typedef typename traits::r_vector_const_iterator<VECSXP>::type const_iterator;
 
-    ListOf(): list(R_NilValue) {}
+    ListOf(): list(R_NilValue), lazy(false), pending(0) {}
 
-    ListOf(SEXP data_): list(data_) {
-        std::transform(list.begin(), list.end(), list.begin(), as<T>);
+    ListOf(SEXP data_): list(data_), lazy(false), pending(0) {
+        convert_all();
     }
 
     template <typename U>
-    ListOf(const U& data_): list(data_) {
-        std::transform(list.begin(), list.end(), list.begin(), as<T>);
+    ListOf(const U& data_): list(data_), lazy(false), pending(0) {
+        convert_all();
     }
 
-    ListOf(const ListOf& other): list(other.list) {}
+    // on-demand mode: element i is checked, and converted if needed, the
+    // first time it is accessed. The remaining elements are converted when
+    // the whole list is requested (get, iteration, conversion to SEXP)
+    ListOf(SEXP data_, const lazy_convert&): list(data_), lazy(true),
+        converted(list.size(), false), pending(list.size()) {}
+
+    ListOf(const ListOf& other): list(other.list), lazy(other.lazy),
+        converted(other.converted), pending(other.pending) {}
 
     ListOf& operator=(const ListOf& other) {
         if (this != &other) {
             list = other.list;
+            lazy = other.lazy;
+            converted = other.converted;
+            pending = other.pending;
         }
         return *this;
     }
@@ -52,42 +83,57 @@ public:
     template <typename U>
     ListOf& operator=(const U& other) {
         list = as<List>(other);
+        if (lazy) {
+            converted.assign(list.size(), false);
+            pending = list.size();
+        }
         return *this;
     }
 
     // subsetting operators
 
     ChildVector<T> operator[](int i) {
+        convert(i);
         return ChildVector<T>(list[i], list, i);
     }
 
     const ChildVector<T> operator[](int i) const {
+        convert(i);
         return ChildVector<T>(list[i], list, i);
     }
 
     ChildVector<T> operator[](const std::string& str) {
-        return ChildVector<T>(list[str], list, list.findName(str));
+        int i = list.findName(str);
+        convert(i);
+        return ChildVector<T>(list[i], list, i);
     }
 
     const ChildVector<T> operator[](const std::string& str) const {
-        return ChildVector<T>(list[str], list, list.findName(str));
+        int i = list.findName(str);
+        convert(i);
+        return ChildVector<T>(list[i], list, i);
     }
 
-    // iteration operators pass down to list
+    // iteration operators pass down to list, after the elements not
+    // converted yet, whichever of begin() and end() is called first
 
     inline iterator begin() {
+        convert_pending();
         return list.begin();
     }
 
     inline iterator end() {
+        convert_pending();
         return list.end();
     }
 
     inline const_iterator begin() const {
+        convert_pending();
         return list.begin();
     }
 
     inline const_iterator end() const {
+        convert_pending();
         return list.end();
     }
 
@@ -96,16 +142,71 @@ public:
     }
 
     inline List get() const {
+        convert_pending();
         return list;
     }
 
+    /**
+     * Checks, without allocating, whether every element of the list
+     * already has the SEXPTYPE expected by T, in which case no
+     * conversion is needed at all
+     */
+    inline bool is_valid() const {
+        int n = list.size();
+        for (int i = 0; i < n; i++) {
+            if (!traits::list_of_element<T>::check(VECTOR_ELT(list, i))) return false;
+        }
+        return true;
+    }
+
+    inline bool is_lazy() const {
+        return lazy;
+    }
+
     // conversion operators
-    operator SEXP() const { return wrap(list); }
-    operator List() const { return list; }
+    operator SEXP() const {
+        convert_pending();
+        return wrap(list);
+    }
+    operator List() const {
+        convert_pending();
+        return list;
+    }
 
 private:
 
     List list;
+    bool lazy;
+
+    // in lazy mode, which elements have already been checked, and how
+    // many have not
+    mutable std::vector<bool> converted;
+    mutable int pending;
+
+    inline void convert_element(int i) const {
+        SEXP x = VECTOR_ELT(list, i);
+        if (!traits::list_of_element<T>::check(x)) {
+            SET_VECTOR_ELT(list, i, as<T>(x));
+        }
+    }
+
+    inline void convert(int i) const {
+        if (!lazy || i < 0 || i >= static_cast<int>(converted.size()) || converted[i]) return;
+        convert_element(i);
+        converted[i] = true;
+        pending--;
+    }
+
+    inline void convert_pending() const {
+        if (!lazy || pending == 0) return;
+        int n = converted.size();
+        for (int i = 0; i < n; i++) convert(i);
+    }
+
+    inline void convert_all() {
+        int n = list.size();
+        for (int i = 0; i < n; i++) convert_element(i);
+    }
 
 }; // ListOf<T>
 
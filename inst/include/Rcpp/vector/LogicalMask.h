@@ -0,0 +1,387 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// LogicalMask.h: Rcpp R/C++ interface class library -- bit packed logical vectors
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_vector_LogicalMask_h_
+#define Rcpp_vector_LogicalMask_h_
+
+#include <stdint.h>
+
+namespace Rcpp {
+
+namespace internal {
+
+    inline int popcount64(uint64_t x) {
+#if defined(__GNUC__)
+        return __builtin_popcountll(x);
+#else
+        int n = 0;
+        for (; x; x &= x - 1) ++n;
+        return n;
+#endif
+    }
+
+    // index of the lowest set bit, x must not be 0
+    inline int ctz64(uint64_t x) {
+#if defined(__GNUC__)
+        return __builtin_ctzll(x);
+#else
+        int n = 0;
+        while (!(x & 1)) { x >>= 1; ++n; }
+        return n;
+#endif
+    }
+
+}
+
+/**
+ * A logical vector stored as two bitmaps, one bit per element: the TRUE
+ * elements and the NA elements. It takes 32 times less memory than a
+ * LogicalVector, and &, |, ! and the counts work on 64 elements at once.
+ *
+ * Any logical sugar expression converts to a mask, e.g.
+ *
+ *     LogicalMask keep = x > 0.0 ;
+ *     NumericVector y = x[ keep ] ;
+ *     int n = sum( keep ) ;
+ *
+ * A mask is itself a logical sugar expression, so it can be given to
+ * functions that do not know about masks. sum, any, all, which and
+ * logical subsetting of vectors have versions working on the words.
+ */
+class LogicalMask : public VectorBase< LGLSXP, true, LogicalMask > {
+public:
+    typedef uint64_t word;
+    enum { BITS = 64 };
+
+    LogicalMask() : n(0), values(), na() {}
+
+    // n elements, all TRUE or all FALSE
+    explicit LogicalMask(int n_, bool value = false) :
+        n(n_), values(n_words(n_), value ? ~static_cast<word>(0) : 0), na(n_words(n_), 0)
+    {
+        clear_tail();
+    }
+
+    template <bool NA, typename T>
+    LogicalMask(const VectorBase<LGLSXP, NA, T>& expr) :
+        n(expr.size()), values(n_words(n)), na(n_words(n))
+    {
+        const T& ref = expr.get_ref();
+        int nw = static_cast<int>(values.size());
+        for (int w=0; w < nw; ++w) {
+            int start = w * BITS;
+            int m = std::min(static_cast<int>(BITS), n - start);
+            word v = 0, a = 0;
+            for (int b=0; b < m; ++b) {
+                int x = ref[start + b];
+                word is_na = x == NA_LOGICAL;
+                // NA is not 0, so TRUE is "not 0" without NA
+                v |= ( static_cast<word>(x != 0) ^ is_na ) << b;
+                a |= is_na << b;
+            }
+            values[w] = v;
+            na[w] = a;
+        }
+    }
+
+    inline int operator[](int i) const {
+        word bit = static_cast<word>(1) << (i % BITS);
+        if (na[i / BITS] & bit) return NA_LOGICAL;
+        return (values[i / BITS] & bit) ? TRUE : FALSE;
+    }
+
+    inline int size() const { return n; }
+
+    // number of TRUE elements
+    int count() const {
+        int res = 0;
+        for (size_t w=0; w < values.size(); ++w) res += internal::popcount64(values[w]);
+        return res;
+    }
+
+    // number of NA elements
+    int count_na() const {
+        int res = 0;
+        for (size_t w=0; w < na.size(); ++w) res += internal::popcount64(na[w]);
+        return res;
+    }
+
+    bool has_true() const { return any_bit(values); }
+    bool has_na() const { return any_bit(na); }
+
+    // whether some element is FALSE
+    bool has_false() const {
+        int nw = static_cast<int>(values.size());
+        for (int w=0; w < nw; ++w) {
+            if (~(values[w] | na[w]) & tail_mask(w)) return true;
+        }
+        return false;
+    }
+
+    /**
+     * calls f(i) for the position i of each TRUE element, in order
+     */
+    template <typename Function>
+    void for_each_true(Function& f) const {
+        int nw = static_cast<int>(values.size());
+        for (int w=0; w < nw; ++w) {
+            word bits = values[w];
+            while (bits) {
+                f(w * BITS + internal::ctz64(bits));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    // R semantics: FALSE & NA is FALSE, TRUE & NA is NA
+    LogicalMask& operator&=(const LogicalMask& other) {
+        check_size(other);
+        for (size_t w=0; w < values.size(); ++w) {
+            word not_false = values[w] | na[w], other_not_false = other.values[w] | other.na[w];
+            na[w] = (na[w] & other_not_false) | (other.na[w] & not_false);
+            values[w] &= other.values[w];
+        }
+        return *this;
+    }
+
+    // R semantics: TRUE | NA is TRUE, FALSE | NA is NA
+    LogicalMask& operator|=(const LogicalMask& other) {
+        check_size(other);
+        for (size_t w=0; w < values.size(); ++w) {
+            values[w] |= other.values[w];
+            na[w] = (na[w] | other.na[w]) & ~values[w];
+        }
+        return *this;
+    }
+
+    // NA stays NA
+    LogicalMask operator!() const {
+        LogicalMask res(*this);
+        for (size_t w=0; w < values.size(); ++w) {
+            res.values[w] = ~(values[w] | na[w]);
+        }
+        res.clear_tail();
+        return res;
+    }
+
+    const word* values_data() const { return values.empty() ? 0 : &values[0]; }
+    const word* na_data() const { return na.empty() ? 0 : &na[0]; }
+
+private:
+
+    static size_t n_words(int n) { return (static_cast<size_t>(n) + BITS - 1) / BITS; }
+
+    // the bits of word w that are elements
+    inline word tail_mask(int w) const {
+        int rest = n - w * BITS;
+        return rest >= BITS ? ~static_cast<word>(0) : (static_cast<word>(1) << rest) - 1;
+    }
+
+    // bits past the last element are kept at 0
+    void clear_tail() {
+        if (!values.empty()) values.back() &= tail_mask(static_cast<int>(values.size()) - 1);
+    }
+
+    static bool any_bit(const std::vector<word>& x) {
+        for (size_t w=0; w < x.size(); ++w) {
+            if (x[w]) return true;
+        }
+        return false;
+    }
+
+    void check_size(const LogicalMask& other) const {
+        if (n != other.n) stop("masks of different sizes");
+    }
+
+    int n;
+    std::vector<word> values;
+    // the bit of an NA element is 0 in values
+    std::vector<word> na;
+};
+
+inline LogicalMask operator&(const LogicalMask& lhs, const LogicalMask& rhs) {
+    LogicalMask res(lhs);
+    return res &= rhs;
+}
+
+inline LogicalMask operator|(const LogicalMask& lhs, const LogicalMask& rhs) {
+    LogicalMask res(lhs);
+    return res |= rhs;
+}
+
+// a mask combined with another logical expression gives a mask, with the
+// same NA rules, rather than the element-wise sugar & and |
+template <bool NA, typename T>
+inline LogicalMask operator&(const LogicalMask& lhs, const VectorBase<LGLSXP, NA, T>& rhs) {
+    LogicalMask res(rhs);
+    return res &= lhs;
+}
+
+template <bool NA, typename T>
+inline LogicalMask operator&(const VectorBase<LGLSXP, NA, T>& lhs, const LogicalMask& rhs) {
+    LogicalMask res(lhs);
+    return res &= rhs;
+}
+
+template <bool NA, typename T>
+inline LogicalMask operator|(const LogicalMask& lhs, const VectorBase<LGLSXP, NA, T>& rhs) {
+    LogicalMask res(rhs);
+    return res |= lhs;
+}
+
+template <bool NA, typename T>
+inline LogicalMask operator|(const VectorBase<LGLSXP, NA, T>& lhs, const LogicalMask& rhs) {
+    LogicalMask res(lhs);
+    return res |= rhs;
+}
+
+namespace internal {
+
+    template <typename STORAGE>
+    struct masked_copy {
+        masked_copy(STORAGE out_, STORAGE in_) : out(out_), in(in_) {}
+        inline void operator()(int i) { *out++ = in[i]; }
+        STORAGE out;
+        STORAGE in;
+    };
+
+    template <typename LHS, typename VALUE>
+    struct masked_fill {
+        masked_fill(LHS& lhs_, const VALUE& value_) : lhs(lhs_), value(value_) {}
+        inline void operator()(int i) { lhs[i] = value; }
+        LHS& lhs;
+        const VALUE& value;
+    };
+
+    template <typename LHS, typename OTHER>
+    struct masked_assign {
+        masked_assign(LHS& lhs_, const OTHER& other_) : lhs(lhs_), other(other_), k(0) {}
+        inline void operator()(int i) { lhs[i] = other[k++]; }
+        LHS& lhs;
+        const OTHER& other;
+        int k;
+    };
+
+}
+
+/**
+ * x[ mask ], as SubsetProxy but reading the positions from the words of
+ * a LogicalMask
+ */
+template <int RTYPE, template <class> class StoragePolicy>
+class MaskSubsetProxy {
+
+    typedef Vector<RTYPE, StoragePolicy> LHS_t;
+
+public:
+
+    MaskSubsetProxy(LHS_t& lhs_, const LogicalMask& mask_):
+        lhs(lhs_), mask(mask_), indices_n(0) {
+        if (lhs.size() != mask.size()) {
+            stop("logical subsetting requires vectors of identical size");
+        }
+        if (mask.has_na()) {
+            stop("can't subset using a logical vector with NAs");
+        }
+        indices_n = mask.count();
+    }
+
+    // Enable e.g. x[y] = z
+    template <int OtherRTYPE, template <class> class OtherStoragePolicy>
+    MaskSubsetProxy& operator=(const Vector<OtherRTYPE, OtherStoragePolicy>& other) {
+        int n = other.size();
+        if (n == 1) {
+            typename Vector<OtherRTYPE, OtherStoragePolicy>::stored_type value = other[0];
+            fill(value);
+        } else if (n == indices_n) {
+            internal::masked_assign< LHS_t, Vector<OtherRTYPE, OtherStoragePolicy> > f(lhs, other);
+            mask.for_each_true(f);
+        } else {
+            stop("index error");
+        }
+        return *this;
+    }
+
+    MaskSubsetProxy& operator=(double other) { return fill(other); }
+    MaskSubsetProxy& operator=(int other) { return fill(other); }
+    MaskSubsetProxy& operator=(const char* other) { return fill(other); }
+    MaskSubsetProxy& operator=(bool other) { return fill(other); }
+
+    operator Vector<RTYPE, StoragePolicy>() const {
+        return get_vec();
+    }
+
+    operator SEXP() const {
+        return wrap( get_vec() );
+    }
+
+private:
+
+    typedef typename traits::storage_type<RTYPE>::type STORAGE;
+
+    template <typename T>
+    MaskSubsetProxy& fill(const T& value) {
+        internal::masked_fill<LHS_t, T> f(lhs, value);
+        mask.for_each_true(f);
+        return *this;
+    }
+
+    void fill_vec( Vector<RTYPE, StoragePolicy>& output, traits::true_type ) const {
+        internal::masked_copy<STORAGE*> f(
+            internal::r_vector_start<RTYPE>(output),
+            internal::r_vector_start<RTYPE>(lhs)
+        );
+        mask.for_each_true(f);
+    }
+
+    void fill_vec( Vector<RTYPE, StoragePolicy>& output, traits::false_type ) const {
+        internal::masked_copy<typename LHS_t::iterator> f( output.begin(), lhs.begin() );
+        mask.for_each_true(f);
+    }
+
+    Vector<RTYPE, StoragePolicy> get_vec() const {
+        Vector<RTYPE, StoragePolicy> output = no_init(indices_n);
+        fill_vec( output, typename traits::r_vector_direct_access<RTYPE>::type() );
+        SEXP names = Rf_getAttrib(lhs, R_NamesSymbol);
+        if (!Rf_isNull(names)) {
+            Vector<STRSXP, StoragePolicy> out_names = no_init(indices_n);
+            Vector<STRSXP, StoragePolicy> lhs_names(names);
+            internal::masked_copy<typename Vector<STRSXP, StoragePolicy>::iterator> f(
+                out_names.begin(), lhs_names.begin()
+            );
+            mask.for_each_true(f);
+            Rf_setAttrib(output, R_NamesSymbol, out_names);
+        }
+        Rf_copyMostAttrib(lhs, output);
+        return output;
+    }
+
+    LHS_t& lhs;
+    // by value, as the rhs of SubsetProxy: the mask is often a temporary,
+    // e.g. in x[ m1 & m2 ], and copying it only copies its words
+    LogicalMask mask;
+    int indices_n;
+
+};
+
+}
+
+#endif
@@ -73,6 +73,13 @@ public:
         import_matrix_expression<NA,MAT>( other, nrows, ncol() ) ;
     }
 
+    template <int RT, bool LHS_NA, typename LHS_T, bool RHS_NA, typename RHS_T, typename Function>
+    Matrix( const MatrixBase<RTYPE, true, sugar::Outer<RT,LHS_NA,LHS_T,RHS_NA,RHS_T,Function> >& other ) :
+        VECTOR( Rf_allocMatrix( RTYPE, other.nrow(), other.ncol() ) ), nrows(other.nrow())
+    {
+        static_cast< const sugar::Outer<RT,LHS_NA,LHS_T,RHS_NA,RHS_T,Function>& >( other ).import_into( *this, 1 ) ;
+    }
+
     Matrix( const SubMatrix<RTYPE>& ) ;
 
     Matrix& operator=(const Matrix& other) {
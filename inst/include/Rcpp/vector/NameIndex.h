@@ -0,0 +1,114 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// NameIndex.h: Rcpp R/C++ interface class library -- hashed lookup of names
+//
+// Copyright (C) 2014  Dirk Eddelbuettel and Romain Francois
+//
+// This file is part of Rcpp.
+//
+// Rcpp is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Rcpp is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef Rcpp_vector_NameIndex_h_
+#define Rcpp_vector_NameIndex_h_
+
+// subsets of vectors with fewer names are found by linear scans
+#ifndef RCPP_NAME_INDEX_MIN_SIZE
+#define RCPP_NAME_INDEX_MIN_SIZE 64
+#endif
+
+namespace Rcpp{
+namespace internal{
+
+/**
+ * Hash table from the names of a vector to the position of their first
+ * occurrence, keyed on the content of the strings, so that lookups need
+ * neither a CHARSXP nor an allocation. It is built for a batch of
+ * lookups (e.g. the names of a subset), the names must outlive it and
+ * must not change while it is used.
+ */
+class NameIndex {
+public:
+    NameIndex() : names(R_NilValue), k(0), data() {}
+
+    NameIndex( SEXP names_ ) : names(R_NilValue), k(0), data() {
+        build( names_ ) ;
+    }
+
+    void build( SEXP names_ ){
+        names = names_ ;
+        int n = Rf_length( names ) ;
+        int m = 2 ;
+        k = 1 ;
+        while( m < 2 * n ){ m *= 2 ; k++ ; }
+        data.assign( m, 0 ) ;
+        for( int i=0; i<n; i++){
+            const char* name = CHAR( STRING_ELT( names, i ) ) ;
+            int addr = get_addr( name ) ;
+            while( data[addr] && strcmp( CHAR( STRING_ELT( names, data[addr] - 1 ) ), name ) ){
+                if( ++addr == m ) addr = 0 ;
+            }
+            if( !data[addr] ) data[addr] = i + 1 ;
+        }
+    }
+
+    /**
+     * position of the first name equal to name, -1 if there is none
+     */
+    int find( const char* name ) const {
+        if( data.empty() ) return -1 ;
+        int m = data.size() ;
+        int addr = get_addr( name ) ;
+        while( data[addr] ){
+            int i = data[addr] - 1 ;
+            if( ! strcmp( CHAR( STRING_ELT( names, i ) ), name ) ) return i ;
+            if( ++addr == m ) addr = 0 ;
+        }
+        return -1 ;
+    }
+
+    inline int find( SEXP name ) const {
+        return find( CHAR(name) ) ;
+    }
+
+    /**
+     * position of the first element of names equal to name, -1 if there
+     * is none
+     */
+    static int find_scan( SEXP names, const char* name ){
+        int n = Rf_length( names ) ;
+        for( int i=0; i<n; i++){
+            if( ! strcmp( name, CHAR( STRING_ELT(names, i) ) ) ) return i ;
+        }
+        return -1 ;
+    }
+
+private:
+    SEXP names ;
+    int k ;
+    std::vector<int> data ;
+
+    // FNV-1a, top k bits
+    inline int get_addr( const char* name ) const {
+        unsigned int h = 2166136261U ;
+        for( const unsigned char* p = reinterpret_cast<const unsigned char*>(name); *p; p++ ){
+            h = ( h ^ *p ) * 16777619U ;
+        }
+        return ( 3141592653U * h ) >> ( 32 - k ) ;
+    }
+} ;
+
+} // internal
+} // Rcpp
+
+#endif
@@ -24,6 +24,34 @@
 
 namespace Rcpp {
 
+/**
+ * Elements of a vector at the given (0-based) positions, read lazily by
+ * sugar expressions without copying them in a new vector
+ */
+template <int RTYPE, template <class> class StoragePolicy>
+class SubsetView : public VectorBase< RTYPE, true, SubsetView<RTYPE, StoragePolicy> > {
+public:
+    typedef typename traits::storage_type<RTYPE>::type STORAGE;
+
+    SubsetView(const Vector<RTYPE, StoragePolicy>& x_, const Vector<INTSXP, StoragePolicy>& indices_):
+        x(x_), indices(indices_),
+        start( internal::r_vector_start<RTYPE>(x) ), positions( INTEGER(indices) ) {}
+
+    inline STORAGE operator[](int i) const {
+        return start[ positions[i] ];
+    }
+
+    inline int size() const {
+        return indices.size();
+    }
+
+private:
+    Vector<RTYPE, StoragePolicy> x;
+    Vector<INTSXP, StoragePolicy> indices;
+    const STORAGE* start;
+    const int* positions;
+};
+
 template <
     int RTYPE, template <class> class StoragePolicy,
     int RHS_RTYPE, bool RHS_NA, typename RHS_T
@@ -52,6 +80,7 @@ public:
     template <int OtherRTYPE, template <class> class OtherStoragePolicy>
     SubsetProxy& operator=(const Vector<OtherRTYPE, OtherStoragePolicy>& other) {
         int n = other.size();
+        materialize_indices();
         if (indices_n != n) stop("index error");
         if (n == 1) {
             for (int i=0; i < n; ++i) {
@@ -70,6 +99,7 @@ public:
     // Enable e.g. x[y] = 1;
     // TODO: std::enable_if<primitive> with C++11
     SubsetProxy& operator=(double other) {
+        materialize_indices();
         for (int i=0; i < indices_n; ++i) {
             lhs[ indices[i] ] = other;
         }
@@ -77,6 +107,7 @@ public:
     }
 
     SubsetProxy& operator=(int other) {
+        materialize_indices();
         for (int i=0; i < indices_n; ++i) {
             lhs[ indices[i] ] = other;
         }
@@ -84,6 +115,7 @@ public:
     }
 
     SubsetProxy& operator=(const char* other) {
+        materialize_indices();
         for (int i=0; i < indices_n; ++i) {
             lhs[ indices[i] ] = other;
         }
@@ -91,6 +123,7 @@ public:
     }
 
     SubsetProxy& operator=(bool other) {
+        materialize_indices();
         for (int i=0; i < indices_n; ++i) {
             lhs[ indices[i] ] = other;
         }
@@ -105,8 +138,19 @@ public:
         return wrap( get_vec() );
     }
 
+    // lazy view of the selected elements, e.g. for sum( x[ x > 0 ].view() )
+    SubsetView<RTYPE, StoragePolicy> view() const {
+        materialize_indices();
+        return SubsetView<RTYPE, StoragePolicy>(
+            lhs,
+            index_vector( traits::identity< traits::int2type<RHS_RTYPE> >() )
+        );
+    }
+
 private:
 
+    typedef typename traits::storage_type<RTYPE>::type STORAGE;
+
     #ifndef RCPP_NO_BOUNDS_CHECK
     void check_indices(int* x, int n, int size) {
         for (int i=0; i < n; ++i) {
@@ -141,47 +185,130 @@ private:
         indices.reserve(rhs_n);
         SEXP names = Rf_getAttrib(lhs, R_NamesSymbol);
         if (Rf_isNull(names)) stop("names is null");
-        for (int i=0; i < rhs_n; ++i) {
-            indices.push_back( find(names, CHAR( STRING_ELT(rhs, i) )) );
+        if (lhs_n < RCPP_NAME_INDEX_MIN_SIZE) {
+            for (int i=0; i < rhs_n; ++i) {
+                indices.push_back( check_name( internal::NameIndex::find_scan(names, CHAR(STRING_ELT(rhs, i))) ) );
+            }
+        } else {
+            // names are hashed once for all the lookups of this subset
+            internal::NameIndex index(names);
+            for (int i=0; i < rhs_n; ++i) {
+                indices.push_back( check_name( index.find(STRING_ELT(rhs, i)) ) );
+            }
         }
         indices_n = indices.size();
     }
 
-    int find(const RHS_t& names, const char* str) {
-        for (int i=0; i < lhs_n; ++i) {
-            if (strcmp( CHAR( STRING_ELT( names, i) ), str) == 0) return i;
-        }
-        stop("no name found");
-        return -1;
+    int check_name(int i) {
+        if (i < 0) stop("no name found");
+        return i;
     }
 
+    // logical subsets only count the selected elements here, the
+    // elements are then copied straight from the mask (see get_vec)
+    // and the indices are only built when needed for an assignment
     void get_indices( traits::identity< traits::int2type<LGLSXP> > t ) {
-        indices.reserve(rhs_n);
         if (lhs_n != rhs_n) {
             stop("logical subsetting requires vectors of identical size");
         }
         int* ptr = LOGICAL(rhs);
+        int n = 0;
         for (int i=0; i < rhs_n; ++i) {
             if (ptr[i] == NA_INTEGER) {
                 stop("can't subset using a logical vector with NAs");
             }
-            if (ptr[i]) {
-                indices.push_back(i);
+            n += ptr[i] != 0;
+        }
+        indices_n = n;
+    }
+
+    template <typename T>
+    void materialize_indices( T ) const {}
+
+    void materialize_indices( traits::identity< traits::int2type<LGLSXP> > t ) const {
+        if (static_cast<int>(indices.size()) == indices_n) return;
+        indices.reserve(indices_n);
+        int* ptr = LOGICAL(rhs);
+        for (int i=0; i < rhs_n; ++i) {
+            if (ptr[i]) indices.push_back(i);
+        }
+    }
+
+    void materialize_indices() const {
+        materialize_indices( traits::identity< traits::int2type<RHS_RTYPE> >() );
+    }
+
+    static const int* index_data(int* x) { return x; }
+    static const int* index_data(const std::vector<int>& x) {
+        return x.empty() ? 0 : &x[0];
+    }
+
+    template <typename T>
+    Vector<INTSXP, StoragePolicy> index_vector( T ) const {
+        return Vector<INTSXP, StoragePolicy>( indices.begin(), indices.end() );
+    }
+
+    Vector<INTSXP, StoragePolicy> index_vector( traits::identity< traits::int2type<INTSXP> > t ) const {
+        return rhs;
+    }
+
+    // whether the indices are first, first + 1, ...
+    static bool is_range(const int* x, int n) {
+        for (int i=1; i < n; ++i) {
+            if (x[i] != x[0] + i) return false;
+        }
+        return true;
+    }
+
+    // copy of the elements selected by the mask
+    template <typename OUT, typename IN>
+    static void copy_masked(OUT out, IN in, const int* mask, int n) {
+        for (int i=0; i < n; ++i) {
+            if (mask[i]) *out++ = in[i];
+        }
+    }
+
+    // copy of the elements at the given positions
+    template <typename OUT, typename IN>
+    static void copy_indexed(OUT out, IN in, const int* x, int n) {
+        if (n > 0 && is_range(x, n)) {
+            std::copy( in + x[0], in + x[0] + n, out );
+        } else {
+            for (int i=0; i < n; ++i) {
+                out[i] = in[ x[i] ];
             }
         }
-        indices_n = indices.size();
+    }
+
+    void fill_vec( Vector<RTYPE, StoragePolicy>& output, traits::true_type ) const {
+        const STORAGE* in = internal::r_vector_start<RTYPE>(lhs);
+        STORAGE* out = internal::r_vector_start<RTYPE>(output);
+        if (RHS_RTYPE == LGLSXP) {
+            copy_masked( out, in, LOGICAL(rhs), lhs_n );
+        } else {
+            copy_indexed( out, in, index_data(indices), indices_n );
+        }
+    }
+
+    void fill_vec( Vector<RTYPE, StoragePolicy>& output, traits::false_type ) const {
+        if (RHS_RTYPE == LGLSXP) {
+            copy_masked( output.begin(), lhs.begin(), LOGICAL(rhs), lhs_n );
+        } else {
+            copy_indexed( output.begin(), lhs.begin(), index_data(indices), indices_n );
+        }
     }
 
     Vector<RTYPE, StoragePolicy> get_vec() const {
         Vector<RTYPE, StoragePolicy> output = no_init(indices_n);
-        for (int i=0; i < indices_n; ++i) {
-            output[i] = lhs[ indices[i] ];
-        }
+        fill_vec( output, typename traits::r_vector_direct_access<RTYPE>::type() );
         SEXP names = Rf_getAttrib(lhs, R_NamesSymbol);
         if (!Rf_isNull(names)) {
-            Shield<SEXP> out_names( Rf_allocVector(STRSXP, indices_n) );
-            for (int i=0; i < indices_n; ++i) {
-                SET_STRING_ELT(out_names, i, STRING_ELT(names, indices[i]));
+            Vector<STRSXP, StoragePolicy> out_names = no_init(indices_n);
+            Vector<STRSXP, StoragePolicy> lhs_names(names);
+            if (RHS_RTYPE == LGLSXP) {
+                copy_masked( out_names.begin(), lhs_names.begin(), LOGICAL(rhs), lhs_n );
+            } else {
+                copy_indexed( out_names.begin(), lhs_names.begin(), index_data(indices), indices_n );
             }
             Rf_setAttrib(output, R_NamesSymbol, out_names);
         }
@@ -190,13 +317,15 @@ private:
     }
 
     LHS_t& lhs;
-    const RHS_t& rhs;
+    // kept by value: it may be a temporary created from a sugar expression
+    RHS_t rhs;
     int lhs_n;
     int rhs_n;
 
     // we want to reuse the indices if an IntegerVector is passed in; otherwise,
-    // we construct a std::vector<int> to hold the indices
-    typename traits::if_<
+    // we construct a std::vector<int> to hold the indices (only on demand
+    // for a LogicalVector)
+    mutable typename traits::if_<
         RHS_RTYPE == INTSXP,
         int*,
         std::vector<int>
@@ -22,6 +22,7 @@
 #ifndef Rcpp__vector__Vector_h
 #define Rcpp__vector__Vector_h
 
+#include <Rcpp/vector/NameIndex.h>
 #include <Rcpp/vector/Subsetter.h>
 
 namespace Rcpp{
@@ -260,14 +261,9 @@ public:
     R_len_t offset(const std::string& name) const {
         SEXP names = RCPP_GET_NAMES( Storage::get__() ) ;
         if( Rf_isNull(names) ) throw index_out_of_bounds();
-        R_len_t n=size() ;
-        for( R_len_t i=0; i<n; ++i){
-            if( ! name.compare( CHAR(STRING_ELT(names, i)) ) ){
-                return i ;
-            }
-        }
-        throw index_out_of_bounds() ;
-        return -1 ; /* -Wall */
+        int i = internal::NameIndex::find_scan( names, name.c_str() ) ;
+        if( i < 0 ) throw index_out_of_bounds() ;
+        return i ;
     }
 
     template <typename U>
@@ -334,13 +330,21 @@ public:
         );
     }
 
+    // bit packed logical subsetting, see LogicalMask.h
+    MaskSubsetProxy<RTYPE, StoragePolicy> operator[](const LogicalMask& rhs) {
+        return MaskSubsetProxy<RTYPE, StoragePolicy>( *this, rhs );
+    }
+
+    const MaskSubsetProxy<RTYPE, StoragePolicy> operator[](const LogicalMask& rhs) const {
+        return MaskSubsetProxy<RTYPE, StoragePolicy>(
+            const_cast< Vector<RTYPE, StoragePolicy>& >(*this),
+            rhs
+        );
+    }
+
     Vector& sort(){
         typename traits::storage_type<RTYPE>::type* start = internal::r_vector_start<RTYPE>( Storage::get__() ) ;
-        std::sort(
-            start,
-            start + size(),
-            internal::NAComparator<typename traits::storage_type<RTYPE>::type >()
-        ) ;
+        internal::radix_sort( start, start + size() ) ;
         return *this ;
     }
 
@@ -926,7 +930,7 @@ private:
         int n = size() ;
         if( n == x.size() ){
             // just copy the data
-            import_expression<T>(x, n ) ;
+            import_expression(x, n ) ;
         } else{
             // different size, so we change the memory
             Shield<SEXP> wrapped(wrap(x));
@@ -955,7 +959,7 @@ private:
         RCPP_DEBUG_4( "Vector<%d>::import_sugar_expression( VectorBase<%d,%d,%s>, false_type )", RTYPE, NA, RTYPE, DEMANGLE(VEC) ) ;
         int n = other.size() ;
         Storage::set__( Rf_allocVector( RTYPE, n ) ) ;
-        import_expression<VEC>( other.get_ref() , n ) ;
+        import_expression( other.get_ref() , n ) ;
     }
 
     // we are importing a sugar expression that actually is a vector
@@ -972,6 +976,12 @@ private:
         RCPP_LOOP_UNROLL(start,other)
     }
 
+    // densities computed by blocks, see stats/dpq/batch.h
+    template <typename KERNEL, int RT, bool NA, typename T>
+    inline void import_expression( const stats::DBatch<KERNEL,RT,NA,T>& other, int n ) {
+        other.import_into( begin(), n ) ;
+    }
+
     template <typename T>
     inline void fill_or_generate( const T& t) {
         fill_or_generate__impl( t, typename traits::is_generator<T>::type() ) ;
@@ -86,6 +86,13 @@ namespace traits{
 	template <> struct r_vector_cache_type<EXPRSXP> { typedef proxy_cache<EXPRSXP> type ; } ;
 	template <> struct r_vector_cache_type<STRSXP>  { typedef proxy_cache<STRSXP> type ;  } ;
 
+	// whether the elements of the vector can be read and written directly
+	// through its data pointer, i.e. without the R API
+	template <int RTYPE> struct r_vector_direct_access : public true_type {} ;
+	template <> struct r_vector_direct_access<VECSXP>  : public false_type {} ;
+	template <> struct r_vector_direct_access<EXPRSXP> : public false_type {} ;
+	template <> struct r_vector_direct_access<STRSXP>  : public false_type {} ;
+
 } // traits
 }
 
@@ -153,6 +153,7 @@ namespace Rcpp{
 
 #include <Rcpp/internal/na.h>
 #include <Rcpp/internal/NAComparator.h>
+#include <Rcpp/internal/radix_sort.h>
 #include <Rcpp/internal/NAEquals.h>
 
 #include <Rcpp/traits/traits.h>
@@ -160,6 +161,7 @@ namespace Rcpp{
 
 #include <Rcpp/internal/caster.h>
 #include <Rcpp/internal/r_vector.h>
+#include <Rcpp/internal/parallel.h>
 #include <Rcpp/r_cast.h>
 
 #include <Rcpp/api/bones/bones.h>
@@ -150,4 +150,19 @@ Environment runit_child(){
     return global_env.new_child(false) ;
 }
 
+// [[Rcpp::export]]
+List runit_symbols( Environment e ){
+    RCPP_CACHED_SYMBOL( sym_x, "x" ) ;
+    RCPP_CACHED_SYMBOL( sym_y, "y" ) ;
+    List out(4) ;
+    out[0] = e.exists( sym_x ) ;
+    out[1] = e.get( sym_x ) ;
+    e.assign( sym_y, 2 ) ;
+    e[ sym_x ] = "foo" ;
+    out[2] = e[ sym_x ] ;
+    NumericVector v = e.get( sym_y ) ;
+    v.attr( Symbol("foo") ) = "bar" ;
+    out[3] = v.attr( "foo" ) ;
+    return out ;
+}
 
@@ -98,3 +98,29 @@ NumericVector test_nested_listof(ListOf< ListOf<NumericVector> > x) {
 ListOf<IntegerVector> test_return_IVList(List x) {
     return x;
 }
+
+// [[Rcpp::export]]
+double test_lazy_first(List x) {
+    NVList y(x, lazy_convert());
+    return sum(y[0]);
+}
+
+// [[Rcpp::export]]
+List test_lazy_get(List x) {
+    NVList y(x, lazy_convert());
+    return y.get();
+}
+
+// [[Rcpp::export]]
+List test_lazy_end(List x) {
+    NVList y(x, lazy_convert());
+    // end() alone converts the pending elements, in x itself
+    y.end();
+    return x;
+}
+
+// [[Rcpp::export]]
+bool test_is_valid(List x) {
+    NVList y(x, lazy_convert());
+    return y.is_valid();
+}
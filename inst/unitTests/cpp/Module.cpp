@@ -63,6 +63,9 @@ public:
     void set_ref(std::string& msg_) { this->msg = msg_; }
     void set_const_ref(const std::string& msg_) { this->msg = msg_; }
     std::string greet() { return msg; }
+    void reset() { msg = "hello" ; }
+    std::string reset_to(std::string msg_) { std::string old = msg ; msg = msg_ ; return old ; }
+    List boxed(SEXP x) { return List::create( x ) ; }
 
 private:
     std::string msg;
@@ -159,6 +162,9 @@ RCPP_MODULE(yada){
 		.method( "set_ref", &World::set_ref )
 		.method( "set_const_ref", &World::set_const_ref )
 		.method( "clear", &clearWorld )
+		.method( "reset", &World::reset_to )
+		.method( "reset", &World::reset )
+		.method( "boxed", &World::boxed )
 	;
 
 	class_<Num>( "Num" )
@@ -28,3 +28,16 @@ std::string runit_Reference_getId(Reference obj) {
     return txt;
 }
 
+
+// [[Rcpp::export]]
+List runit_Reference_fields(Reference obj, int n) {
+    for (int i=0; i<n; i++) {
+        double count = obj.field("count");
+        obj.field("count") = count + 1;
+        obj.field("last") = i;
+    }
+    const Reference& cobj = obj;
+    double count = cobj.field("count");
+    int last = cobj.field("last");
+    return List::create(count, last);
+}
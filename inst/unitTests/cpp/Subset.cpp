@@ -56,3 +56,40 @@ NumericVector subset_test_assign(NumericVector x) {
 NumericVector subset_test_constref(NumericVector const& x, IntegerVector const& y) {
     return x[y];
 }
+
+// [[Rcpp::export]]
+NumericVector subset_test_names_offset(NumericVector x, CharacterVector y) {
+    NumericVector res( y.size() ) ;
+    for( int i=0; i<y.size(); i++){
+        res[i] = x[ as<std::string>( y[i] ) ] ;
+    }
+    return res ;
+}
+
+// [[Rcpp::export]]
+NumericVector subset_test_names_alternate(NumericVector x, NumericVector y, std::string a, std::string b) {
+    NumericVector z = clone( x ) ;
+    double x1 = z[a], y1 = y[b], x2 = z[a], x3 = z[a] ;
+    // names changed in place after lookups, the first match is found
+    CharacterVector names = z.names() ;
+    names[0] = "renamed" ;
+    names[1] = a ;
+    double x4 = z["renamed"], x5 = z[a] ;
+    NumericVector sub = z[ CharacterVector::create( a ) ] ;
+    return NumericVector::create( x1, y1, x2, x3, x4, x5, sub[0] ) ;
+}
+
+// [[Rcpp::export]]
+double subset_test_view_lgcl(NumericVector x) {
+    return sum( x[ x > 0 ].view() );
+}
+
+// [[Rcpp::export]]
+double subset_test_view_int(NumericVector x, IntegerVector y) {
+    return sum( x[y].view() );
+}
+
+// [[Rcpp::export]]
+List subset_test_list_range(List x, IntegerVector y) {
+    return x[y];
+}
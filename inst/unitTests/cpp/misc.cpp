@@ -20,6 +20,7 @@
 // along with Rcpp.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <Rcpp.h>
+#include <Rcpp/Benchmark/Benchmark.h>
 using namespace Rcpp ;
 using namespace std;
 #include <iostream>
@@ -107,6 +108,48 @@ void test_rcout(std::string tfile, std::string teststring){
     testfile.close();
 }
 
+// [[Rcpp::export]]
+void test_rcout_buffered(int n){
+    Rcout.set_buffered( true ) ;
+    for( int i=0; i<n; i++){
+        Rcout << "line " << i << ":" ;
+        Rcout << ' ' << i * 2 << '\n' ;
+    }
+    Rcout << "no newline" ;
+    Rcout.set_buffered( false ) ;
+}
+
+// [[Rcpp::export]]
+void test_rcout_buffering_throw(){
+    RostreamBuffering buffering( Rcout ) ;
+    Rcout << "before the error\n" ;
+    stop( "error while buffering" ) ;
+}
+
+// [[Rcpp::export]]
+bool test_rcout_is_buffered(){
+    return Rcout.is_buffered() ;
+}
+
+// [[Rcpp::export]]
+void test_rcout_order(){
+    Rcout << "a" ;
+    Rprintf( "b" ) ;
+    Rcout.put( 'c' ) ;
+    Rcout << '\n' ;
+}
+
+// [[Rcpp::export]]
+void test_rcout_collector(){
+    RostreamCollector out( 3 ) ;
+    out[2] << "thread " << 2 << std::endl ;
+    out[0] << "thread " << 0 << std::endl ;
+    Rcout << "before\n" ;
+    out.flush( Rcout ) ;
+    out[1] << "thread " << 1 << std::endl ;
+    out.flush( Rcout ) ;
+}
+
 // [[Rcpp::export]]
 LogicalVector na_proxy(){
     CharacterVector s("foo") ;
@@ -151,3 +194,86 @@ StretchyList named_stretchy_list(){
     return out;
 }
 
+
+struct benchmark_sum {
+    benchmark_sum( NumericVector x_ ) : x(x_){}
+    void operator()() const {
+        result = sum( x ) ;
+    }
+    NumericVector x ;
+    mutable double result ;
+} ;
+
+void benchmark_nothing(){}
+
+// [[Rcpp::export]]
+List benchmark_test( NumericVector x ){
+    Benchmark bench( 20, 2, 5 ) ;
+    bench.run( "sum", benchmark_sum( x ) ).run( "nothing", benchmark_nothing ) ;
+    DataFrame summary = bench ;
+    return List::create(
+        _["summary"] = summary,
+        _["times"] = wrap( bench.get_times( 0 ) )
+    ) ;
+}
+
+// [[Rcpp::export]]
+List interrupt_pollers(int n){
+    InterruptPoller poller( 10, 0 ) ;
+    double s = 0.0 ;
+    for( int i=0; i<n; i++){
+        poller.check() ;
+        s += i ;
+    }
+    ThreadedInterruptPoller threaded( 10, 0 ) ;
+    double t = 0.0 ;
+    for( int i=0; i<n; i++){
+        if( threaded.poll() ) break ;
+        t += i ;
+    }
+    threaded.check() ;
+    return List::create( s, t, threaded.is_interrupted() ) ;
+}
+
+// interrupts are simulated by the check of the pollers, R's own
+// interrupt state is left alone
+static bool fake_interrupt = false ;
+bool fake_interrupt_pending(){
+    return fake_interrupt ;
+}
+
+// an interrupt made pending at iteration `at`: returns the iterations at
+// which InterruptPoller and ThreadedInterruptPoller detect it, and whether
+// a check after the loop finds an interrupt pending during its last
+// iterations
+// [[Rcpp::export]]
+List interrupt_pollers_interrupted(int n, int at){
+    InterruptPoller poller( 10, 0, fake_interrupt_pending ) ;
+    fake_interrupt = false ;
+    int i = 0 ;
+    for( ; i<n; i++){
+        if( i == at ) fake_interrupt = true ;
+        if( poller.poll() ) break ;
+    }
+    ThreadedInterruptPoller threaded( 10, 0, fake_interrupt_pending ) ;
+    fake_interrupt = false ;
+    int j = 0 ;
+    for( ; j<n; j++){
+        if( j == at ) fake_interrupt = true ;
+        if( threaded.poll() ) break ;
+    }
+    bool thrown = false ;
+    try{
+        threaded.check() ;
+    } catch( internal::InterruptedException& ){
+        thrown = true ;
+    }
+    ThreadedInterruptPoller last( n + 1, 0, fake_interrupt_pending ) ;
+    fake_interrupt = false ;
+    for( int k=0; k<n; k++){
+        if( k == n - 1 ) fake_interrupt = true ;
+        last.poll() ;
+    }
+    bool missed = last.is_interrupted() ;
+    return List::create( i, j, thrown, missed, last.poll_now() ) ;
+}
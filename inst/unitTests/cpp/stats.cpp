@@ -79,6 +79,27 @@ List runit_dnorm( NumericVector xx ){
         );
 }
 
+// [[Rcpp::export]]
+List runit_dbatch( NumericVector xx, bool lg ){
+    // long enough to go through several blocks
+    return List::create(
+        _["norm"]  = dnorm( xx, 0.5, 2.0, lg ),
+        _["lnorm"] = dlnorm( xx, 0.5, 2.0, lg ),
+        _["exp"]   = dexp( xx, 3.0, lg ),
+        _["gamma"] = dgamma( xx, 2.5, 1.5, lg ),
+        _["gamma_shape"] = dgamma( xx, 0.5, lg ),
+        _["unif"]  = dunif( xx, -1.0, 3.0, lg )
+        );
+}
+
+// [[Rcpp::export]]
+List runit_dbatch_discrete( NumericVector xx, bool lg ){
+    return List::create(
+        _["pois"]  = dpois( xx, 4.0, lg ),
+        _["binom"] = dbinom( xx, 40.0, 0.3, lg )
+        );
+}
+
 // [[Rcpp::export]]
 List runit_dt( NumericVector xx){
     return List::create(
@@ -253,3 +274,44 @@ List runit_qpois_prob( NumericVector xx ){
 NumericVector runit_qt( NumericVector xx, double d, bool lt, bool lg ){
     return qt( xx, d, lt, lg);
 }
+
+// [[Rcpp::export]]
+NumericVector runit_stream_norm( double seed, int n, int chunks ){
+    // one stream per chunk, as threads would use them
+    NumericVector res( n ) ;
+    std::vector<RandomStream> streams = RandomStream::streams( static_cast<uint64_t>( seed ), chunks ) ;
+    for( int chunk=0; chunk<chunks; chunk++){
+        stats::NormGenerator_Impl<StreamRNG> gen( 1.0, 2.0, streams[chunk] ) ;
+        for( int i=chunk*n/chunks; i<(chunk+1)*n/chunks; i++) res[i] = gen() ;
+    }
+    return res ;
+}
+
+// [[Rcpp::export]]
+bool runit_streams( double seed, int n, int chunks ){
+    // the same streams as those of the constructor
+    std::vector<RandomStream> streams = RandomStream::streams( static_cast<uint64_t>( seed ), chunks ) ;
+    for( int chunk=0; chunk<chunks; chunk++){
+        RandomStream stream( static_cast<uint64_t>( seed ), chunk ) ;
+        for( int i=0; i<n; i++){
+            if( streams[chunk].next() != stream.next() ) return false ;
+        }
+    }
+    return true ;
+}
+
+// [[Rcpp::export]]
+List runit_stream_generators( int n ){
+    RandomStream stream( RandomStream::seed_from_R() ) ;
+    return List::create(
+        _["unif"]  = NumericVector( n, stats::UnifGenerator_Impl<StreamRNG>( 2.0, 4.0, stream ) ),
+        _["exp"]   = NumericVector( n, stats::ExpGenerator_Impl<StreamRNG>( 0.5, stream ) ),
+        _["gamma"] = NumericVector( n, stats::GammaGenerator_Impl<StreamRNG>( 0.5, 3.0, stream ) ),
+        _["chisq"] = NumericVector( n, stats::ChisqGenerator_Impl<StreamRNG>( 6.0, stream ) )
+        );
+}
+
+// [[Rcpp::export]]
+NumericVector runit_rnorm_generator( int n ){
+    return NumericVector( n, stats::NormGenerator( 1.0, 2.0 ) ) ;
+}
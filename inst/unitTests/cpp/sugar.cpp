@@ -30,6 +30,13 @@ public:
 
 double raw_square( double x){ return x*x; }
 
+// functor with a non const operator()
+class twice {
+public:
+	typedef double result_type ;
+	double operator()( double x ){ return 2.0 * x ; }
+} ;
+
 // [[Rcpp::export]]
 List runit_abs( NumericVector xx, IntegerVector yy ){
     return List::create( abs(xx), abs(yy) ) ;
@@ -321,6 +328,29 @@ List runit_sapply_list( IntegerVector xx){
     return res ;
 }
 
+// [[Rcpp::export]]
+NumericVector runit_sapply_parallel( NumericVector xx ){
+    return sapply_parallel( xx, square<double>() );
+}
+
+// [[Rcpp::export]]
+NumericVector runit_sapply_parallel_nonconst( NumericVector xx ){
+    return sapply_parallel( xx, twice() );
+}
+
+// [[Rcpp::export]]
+NumericVector runit_sapply_parallel_expr( NumericVector xx ){
+    return sapply_parallel( xx * 2.0 + 1.0, square<double>() );
+}
+
+std::vector<double> raw_twice( double x ){ return std::vector<double>( 2, x ) ; }
+
+// [[Rcpp::export]]
+List runit_lapply_into( NumericVector xx, List out ){
+    lapply_into( xx, raw_twice, out ) ;
+    return out ;
+}
+
 // [[Rcpp::export]]
 IntegerVector runit_seqalong( NumericVector xx ){
     IntegerVector res = seq_along( xx );
@@ -426,6 +456,14 @@ NumericMatrix runit_outer( NumericVector xx, NumericVector yy){
     return m ;
 }
 
+// [[Rcpp::export]]
+List runit_outer_parallel( NumericVector xx, NumericVector yy){
+    return List::create(
+        outer_parallel( xx, yy, std::minus<double>() ),
+        outer_parallel( xx * 2.0, yy, std::multiplies<double>() )
+    ) ;
+}
+
 // [[Rcpp::export]]
 List runit_row( NumericMatrix xx ){
     return List::create(
@@ -537,6 +575,35 @@ NumericVector runit_cumsum( NumericVector xx ){
     return res ;
 }
 
+// [[Rcpp::export]]
+List runit_order( NumericVector x, IntegerVector y, CharacterVector z ){
+    return List::create( order( x ), order( y ), order( z ), sort_index( x ) ) ;
+}
+
+// [[Rcpp::export]]
+List runit_cumulative_int( IntegerVector xx ){
+    IntegerVector sum = cumsum( xx ), max = cummax( xx ), min = cummin( xx ) ;
+    NumericVector prod = cumprod( xx ) ;
+    return List::create(
+        _["cumsum"]  = sum,
+        _["cumprod"] = prod,
+        _["cummax"]  = max,
+        _["cummin"]  = min
+    ) ;
+}
+
+// [[Rcpp::export]]
+List runit_cumulative_real( NumericVector xx ){
+    NumericVector sum = cumsum( xx ), max = cummax( xx ), min = cummin( xx ) ;
+    NumericVector prod = cumprod( xx ) ;
+    return List::create(
+        _["cumsum"]  = sum,
+        _["cumprod"] = prod,
+        _["cummax"]  = max,
+        _["cummin"]  = min
+    ) ;
+}
+
 // [[Rcpp::export]]
 List runit_asvector( NumericMatrix z, NumericVector x, NumericVector y){
     return List::create(
@@ -601,6 +668,32 @@ IntegerVector runit_intersect( IntegerVector x, IntegerVector y){
     return intersect( x, y ) ;
 }
 
+// [[Rcpp::export]]
+List runit_setops( NumericVector x, NumericVector y){
+    return List::create(
+        _["union"]     = union_( x, y ),
+        _["setdiff"]   = setdiff( x, y ),
+        _["intersect"] = intersect( x, y ),
+        _["setequal"]  = setequal( x, y ),
+        _["is_in"]     = is_in( x, y )
+    ) ;
+}
+
+// [[Rcpp::export]]
+IntegerVector runit_match_numeric( NumericVector x, NumericVector table){
+    return match( x, table ) ;
+}
+
+// [[Rcpp::export]]
+List runit_setops_character( CharacterVector x, CharacterVector y){
+    return List::create(
+        _["union"]     = union_( x, y ),
+        _["setdiff"]   = setdiff( x, y ),
+        _["intersect"] = intersect( x, y ),
+        _["is_in"]     = is_in( x, y )
+    ) ;
+}
+
 // [[Rcpp::export]]
 NumericVector runit_clamp( double a, NumericVector x, double b){
     return clamp( a, x, b ) ;
@@ -643,3 +736,49 @@ List vector_vector_logical( NumericVector xx, NumericVector yy){
 			LogicalVector y6 = xx != yy;
 			return List::create(y1, y2, y3, y4, y5, y6);
 }
+
+// [[Rcpp::export]]
+List runit_logical_mask( LogicalVector a, LogicalVector b ){
+    LogicalMask ma = a, mb = b ;
+    return List::create(
+        _["and"] = LogicalVector( ma & mb ),
+        _["or"]  = LogicalVector( ma | mb ),
+        _["not"] = LogicalVector( !ma ),
+        _["sum"] = sum( ma ).get(),
+        _["any"] = LogicalVector::create( any( ma ).get() ),
+        _["all"] = LogicalVector::create( all( ma ).get() ),
+        _["which"] = which( ma, true ),
+        // b is not a mask: these are masks too, with the same NA rules
+        _["and_sugar"] = LogicalVector( ma & b ),
+        _["sugar_and"] = LogicalVector( b & ma ),
+        _["or_sugar"]  = LogicalVector( ma | ( b == TRUE ) )
+    ) ;
+}
+
+// [[Rcpp::export]]
+List runit_logical_mask_subset( NumericVector x ){
+    LogicalMask keep = x > 0.0 ;
+    NumericVector y = x[ keep ] ;
+    NumericVector z = clone( x ) ;
+    z[ keep ] = 0.0 ;
+    // the proxy outlives the temporary mask it was made from
+    MaskSubsetProxy<REALSXP, PreserveStorage> between = x[ keep & ( x < 3.0 ) ] ;
+    NumericVector w = between ;
+    return List::create( y, z, sum( keep ).get(), w ) ;
+}
+
+// [[Rcpp::export]]
+LogicalVector runit_any_all_blocks( NumericVector x, IntegerVector y, LogicalVector z, double c, int ci ){
+    return LogicalVector::create(
+        any( x > c ).get(), all( x > c ).get(),
+        any( y < ci ).get(), all( y < ci ).get(),
+        any( z ).get(), all( z ).get(),
+        any( ( x + 1.0 ) > c ).get(), all( ( x + 1.0 ) > c ).get()
+    ) ;
+}
+
+// [[Rcpp::export]]
+List runit_which( NumericVector x, double c ){
+    LogicalVector l = x > c ;
+    return List::create( which( x > c ), which( l, true ) ) ;
+}
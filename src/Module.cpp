@@ -112,6 +112,9 @@ RCPP_FUN_2(SEXP, CppObject__finalize, XP_Class cl, SEXP obj){
 	cl->run_finalizer( obj ) ;
 	return R_NilValue ;
 }
+RCPP_FUN_4(SEXP, CppMethod__invoke_batch, XP_Class cl, std::string name, SEXP objects, SEXP args){
+	return cl->invoke_batch( name, objects, args ) ;
+}
 
 // .External functions
 SEXP InternalFunction_invoke( SEXP args ){
@@ -164,8 +167,9 @@ SEXP class__dummyInstance(SEXP args) {
 SEXP CppMethod__invoke(SEXP args){
 	SEXP p = CDR(args) ;
 
-	// the external pointer to the class
-	XP_Class clazz( CAR(p) ) ; p = CDR(p);
+	// the external pointer to the class, not wrapped in a XP_Class
+	// which would preserve it
+	Rcpp::class_Base* clazz = reinterpret_cast< Rcpp::class_Base* >( R_ExternalPtrAddr( CAR(p) ) ) ; p = CDR(p);
 
 	// the external pointer to the method
 	SEXP met = CAR(p) ; p = CDR(p) ;
@@ -183,8 +187,9 @@ SEXP CppMethod__invoke(SEXP args){
 SEXP CppMethod__invoke_void(SEXP args){
 	SEXP p = CDR(args) ;
 
-	// the external pointer to the class
-	XP_Class clazz( CAR(p) ) ; p = CDR(p);
+	// the external pointer to the class, not wrapped in a XP_Class
+	// which would preserve it
+	Rcpp::class_Base* clazz = reinterpret_cast< Rcpp::class_Base* >( R_ExternalPtrAddr( CAR(p) ) ) ; p = CDR(p);
 
 	// the external pointer to the method
 	SEXP met = CAR(p) ; p = CDR(p) ;
@@ -202,8 +207,9 @@ SEXP CppMethod__invoke_void(SEXP args){
 SEXP CppMethod__invoke_notvoid(SEXP args){
 	SEXP p = CDR(args) ;
 
-	// the external pointer to the class
-	XP_Class clazz( CAR(p) ) ; p = CDR(p);
+	// the external pointer to the class, not wrapped in a XP_Class
+	// which would preserve it
+	Rcpp::class_Base* clazz = reinterpret_cast< Rcpp::class_Base* >( R_ExternalPtrAddr( CAR(p) ) ) ; p = CDR(p);
 
 	// the external pointer to the method
 	SEXP met = CAR(p) ; p = CDR(p) ;
@@ -53,6 +53,7 @@ static R_CallMethodDef callEntries[]  = {
 
     CALLDEF(CppField__get,3),
     CALLDEF(CppField__set,4),
+    CALLDEF(CppMethod__invoke_batch,4),
 
     CALLDEF(rcpp_capabilities,0),
     CALLDEF(rcpp_can_use_cxx0x,0),
@@ -26,6 +26,8 @@
 #include <errno.h>
 
 #include <cstring>
+#include <ctime>
+#include <sys/time.h>
 
 #include <string>
 #include <vector>
@@ -60,6 +62,12 @@ namespace attributes {
         time_t lastModified_;
     };
 
+    // Hash of the contents of a file (throws on io error)
+    std::string hashFile(const std::string& path);
+
+    // Hash of the path and the contents of a file (throws on io error)
+    std::string hashPathAndFile(const std::string& path);
+
     // Remove a file
     bool removeFile(const std::string& path);
 
@@ -380,6 +388,11 @@ namespace attributes {
             return embeddedR_;
         }
 
+        // Warnings shown while parsing
+        const std::vector<std::string>& warnings() const {
+            return warnings_;
+        }
+
     private:
 
         // Parsing helpers
@@ -413,6 +426,7 @@ namespace attributes {
         std::vector<std::string> embeddedR_;
         std::vector<std::vector<std::string> > roxygenChunks_;
         std::vector<std::string> roxygenBuffer_;
+        std::vector<std::string> warnings_;
     };
 
 } // namespace attributes
@@ -938,6 +952,9 @@ namespace attributes {
 
             // Parse embedded R
             embeddedR_ = parseEmbeddedR(lines_, lines);
+
+            // the lines are only needed while parsing
+            lines_ = CharacterVector(0);
         }
     }
 
@@ -1293,6 +1310,7 @@ namespace attributes {
             ostr << " for " << attribute << " attribute";
         ostr << " at " << file << ":" << lineNumber;
 
+        warnings_.push_back(ostr.str());
         showWarning(ostr.str());
     }
 
@@ -2324,6 +2342,49 @@ namespace attributes {
         }
     }
 
+    // Continue a 32 bit FNV-1a hash with n more bytes
+    unsigned int hashBytes(unsigned int hash, const char* bytes,
+                           std::size_t n) {
+        for (std::size_t i = 0; i < n; i++) {
+            hash ^= static_cast<unsigned char>(bytes[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    // Continue a hash with the contents of a file
+    unsigned int hashContents(unsigned int hash, const std::string& path) {
+        std::ifstream ifs(path.c_str(), std::ifstream::binary);
+        if (ifs.fail())
+            throw Rcpp::file_io_error(path);
+        char buffer[4096];
+        while (ifs) {
+            ifs.read(buffer, sizeof(buffer));
+            hash = hashBytes(hash, buffer,
+                             static_cast<std::size_t>(ifs.gcount()));
+        }
+        return hash;
+    }
+
+    std::string hashToString(unsigned int hash) {
+        std::ostringstream ostr;
+        ostr << hash;
+        return ostr.str();
+    }
+
+    // Hash of the contents of a file (32 bit FNV-1a)
+    std::string hashFile(const std::string& path) {
+        return hashToString(hashContents(2166136261u, path));
+    }
+
+    // Hash of the path and the contents of a file, the path being
+    // terminated by its nul character so that the two can't run together
+    std::string hashPathAndFile(const std::string& path) {
+        unsigned int hash = hashBytes(2166136261u, path.c_str(),
+                                      path.size() + 1);
+        return hashToString(hashContents(hash, path));
+    }
+
     // Remove a file (call back into R for this)
     bool removeFile(const std::string& path) {
         if (FileInfo(path).exists()) {
@@ -2472,10 +2533,10 @@ namespace {
     // Class that manages generation of source code for the sourceCpp dynlib
     class SourceCppDynlib {
     public:
-        SourceCppDynlib() {}
+        SourceCppDynlib() : builds_(0) {}
 
         SourceCppDynlib(const std::string& cppSourcePath, Rcpp::List platform)
-            :  cppSourcePath_(cppSourcePath)
+            :  cppSourcePath_(cppSourcePath), builds_(0)
 
         {
             // get cpp source file info
@@ -2498,9 +2559,6 @@ namespace {
             Rcpp::Function dircreate = Rcpp::Environment::base_env()["dir.create"];
             dircreate(buildDirectory_);
 
-            // generate a random context id
-            contextId_ = "sourceCpp_" + createRandomizer();
-
             // regenerate the source code
             regenerateSource();
         }
@@ -2525,9 +2583,19 @@ namespace {
 
         void regenerateSource() {
 
-            // create new dynlib filename
+            // derive the context id from the path and the contents of the
+            // source file, so that the generated code (and hence a dynlib
+            // built from it in an earlier session and kept in the sourceCpp
+            // cache) is the same for the same source, while files with the
+            // same contents still get their own symbols
+            contextId_ = "sourceCpp_" + hashPathAndFile(cppSourcePath_);
+
+            // create new dynlib filename (numbered so that it differs from
+            // the previous one when the contents haven't changed)
+            std::ostringstream buildId;
+            buildId << "_" << ++builds_;
             previousDynlibFilename_ = dynlibFilename_;
-            dynlibFilename_ = "sourceCpp_" + createRandomizer() + dynlibExt_;
+            dynlibFilename_ = contextId_ + buildId.str() + dynlibExt_;
 
             // copy the source file to the build dir
             Rcpp::Function filecopy = Rcpp::Environment::base_env()["file.copy"];
@@ -2703,13 +2771,6 @@ namespace {
 
         }
 
-        std::string createRandomizer() {
-            Rcpp::Function sample = Rcpp::Environment::base_env()["sample"];
-            std::ostringstream ostr;
-            ostr << Rcpp::as<int>(sample(100000, 1));
-            return ostr.str();
-        }
-
     private:
         std::string cppSourcePath_;
         std::string generatedCpp_;
@@ -2720,6 +2781,7 @@ namespace {
         std::string dynlibFilename_;
         std::string previousDynlibFilename_;
         std::string dynlibExt_;
+        int builds_;
         std::vector<std::string> exportedFunctions_;
         std::vector<std::string> modules_;
         std::vector<std::string> depends_;
@@ -2742,52 +2804,146 @@ namespace {
         // Insert into cache by file name
         SourceCppDynlib* insertFile(const std::string& file,
                                     const SourceCppDynlib& dynlib) {
-            Entry entry;
-            entry.file = file;
-            entry.dynlib = dynlib;
-            entries_.push_back(entry);
-            return &(entries_.rbegin()->dynlib);
+            return &(byFile_[file] = dynlib);
         }
 
         // Insert into cache by code
         SourceCppDynlib* insertCode(const std::string& code,
                                     const SourceCppDynlib& dynlib) {
-            Entry entry;
-            entry.code = code;
-            entry.dynlib = dynlib;
-            entries_.push_back(entry);
-            return &(entries_.rbegin()->dynlib);
+            return &(byCode_[code] = dynlib);
         }
 
         // Lookup by file
         SourceCppDynlib* lookupByFile(const std::string& file) {
-            for (std::size_t i = 0; i < entries_.size(); i++) {
-                if (entries_[i].file == file)
-                    return &(entries_[i].dynlib);
-            }
-
-            return NULL;
+            return lookup(byFile_, file);
         }
 
         // Lookup by code
         SourceCppDynlib* lookupByCode(const std::string& code) {
-            for (std::size_t i = 0; i < entries_.size(); i++) {
-                if (entries_[i].code == code)
-                    return &(entries_[i].dynlib);
+            return lookup(byCode_, code);
+        }
+
+    private:
+        typedef std::map<std::string, SourceCppDynlib> Entries;
+
+        static SourceCppDynlib* lookup(Entries& entries,
+                                       const std::string& key) {
+            Entries::iterator it = entries.find(key);
+            return it != entries.end() ? &(it->second) : NULL;
+        }
+
+        // std::map never moves its elements, so the pointers handed out
+        // stay valid as new entries are inserted
+        Entries byFile_;
+        Entries byCode_;
+    };
+
+    // Attributes parsed by compileAttributes, kept for the session and
+    // reused for the files that did not change since they were parsed.
+    // The warnings shown when a file was parsed are shown again when its
+    // attributes are reused.
+    class SourceFileAttributesCache {
+
+    public:
+        SourceFileAttributesCache() {}
+
+        ~SourceFileAttributesCache() {
+            for (Entries::iterator it = entries_.begin();
+                 it != entries_.end(); ++it) {
+                delete it->second.pAttributes;
+            }
+        }
+
+    private:
+        // prohibit copying
+        SourceFileAttributesCache(const SourceFileAttributesCache&);
+        SourceFileAttributesCache& operator=(const SourceFileAttributesCache&);
+
+    public:
+        // Parse the file, or return its cached attributes if it is
+        // unchanged (pFromCache tells which)
+        const SourceFileAttributes& get(const std::string& file,
+                                        bool* pFromCache) {
+
+            time_t lastModified = FileInfo(file).lastModified();
+            Entries::iterator it = entries_.find(file);
+            if (it != entries_.end()) {
+                Entry& entry = it->second;
+
+                // same modification time, which was already in the past
+                // when the file was parsed (so the file could not have
+                // changed again within the same second)
+                if (entry.lastModified == lastModified &&
+                    lastModified < entry.parseTime) {
+                    *pFromCache = true;
+                    return reuse(entry);
+                }
+
+                // modified but with the same contents (e.g. touched)
+                std::string hash = hashFile(file);
+                if (hash == entry.hash) {
+                    entry.lastModified = lastModified;
+                    entry.parseTime = std::time(NULL);
+                    *pFromCache = true;
+                    return reuse(entry);
+                }
+
+                delete entry.pAttributes;
+                entries_.erase(it);
             }
 
-            return NULL;
+            Entry entry;
+            entry.lastModified = lastModified;
+            entry.parseTime = std::time(NULL);
+            entry.hash = hashFile(file);
+            entry.pAttributes = new SourceFileAttributesParser(file);
+            entries_[file] = entry;
+            *pFromCache = false;
+            return *entry.pAttributes;
+        }
+
+        // Forget the files not in files, e.g. those of another package, so
+        // that the cache only holds the files of the last call
+        void retain(const std::vector<std::string>& files) {
+            std::set<std::string> keep(files.begin(), files.end());
+            Entries::iterator it = entries_.begin();
+            while (it != entries_.end()) {
+                if (keep.count(it->first)) {
+                    ++it;
+                } else {
+                    delete it->second.pAttributes;
+                    entries_.erase(it++);
+                }
+            }
         }
 
     private:
         struct Entry {
-            std::string file;
-            std::string code;
-            SourceCppDynlib dynlib;
+            time_t lastModified;
+            time_t parseTime;
+            std::string hash;
+            SourceFileAttributesParser* pAttributes;
         };
-        std::vector<Entry> entries_;
+        typedef std::map<std::string, Entry> Entries;
+
+        static const SourceFileAttributes& reuse(const Entry& entry) {
+            const std::vector<std::string>& warnings =
+                                            entry.pAttributes->warnings();
+            for (size_t i = 0; i<warnings.size(); i++)
+                showWarning(warnings[i]);
+            return *entry.pAttributes;
+        }
+
+        Entries entries_;
     };
 
+    // Wall clock time in milliseconds, for the timings of compileAttributes
+    double currentTimeMs() {
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+    }
+
 } // anonymous namespace
 
 // Create temporary build directory, generate code as necessary, and return
@@ -2914,14 +3070,23 @@ BEGIN_RCPP
     // write begin
     generators.writeBegin();
 
-    // Parse attributes from each file and generate code as required.
+    // Parse attributes from each file (or reuse them from an earlier call
+    // if the file is unchanged) and generate code as required.
+    static SourceFileAttributesCache s_attributesCache;
+    s_attributesCache.retain(cppFiles);
+    double startTime = currentTimeMs();
+    std::size_t fromCacheCount = 0;
     bool haveAttributes = false;
     std::set<std::string> dependsAttribs;
     for (std::size_t i=0; i<cppFiles.size(); i++) {
 
         // parse file (continue if there is no generator output)
         std::string cppFile = cppFiles[i];
-        SourceFileAttributesParser attributes(cppFile);
+        bool fromCache = false;
+        const SourceFileAttributes& attributes =
+                            s_attributesCache.get(cppFile, &fromCache);
+        if (fromCache)
+            fromCacheCount++;
         if (!attributes.hasGeneratorOutput())
             continue;
 
@@ -2943,6 +3108,7 @@ BEGIN_RCPP
 
     // write end
     generators.writeEnd();
+    double generateTime = currentTimeMs();
 
     // commit or remove
     std::vector<std::string> updated;
@@ -2950,6 +3116,7 @@ BEGIN_RCPP
         updated = generators.commit(includes);
     else
         updated = generators.remove();
+    double commitTime = currentTimeMs();
 
     // print warning if there are depends attributes that don't have
     // corresponding entries in the DESCRIPTION file
@@ -2974,6 +3141,13 @@ BEGIN_RCPP
     if (verbose) {
         for (size_t i=0; i<updated.size(); i++)
             Rcpp::Rcout << updated[i] << " updated." << std::endl;
+
+        Rcpp::Rcout << cppFiles.size() << " source files ("
+                    << fromCacheCount << " unchanged) parsed in "
+                    << (generateTime - startTime) << " ms, "
+                    << "exports written in "
+                    << (commitTime - generateTime) << " ms."
+                    << std::endl;
     }
 
     // return files updated
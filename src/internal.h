@@ -117,6 +117,7 @@ CALLFUN_0(init_Rcpp_cache);
 CALLFUN_1(rcpp_error_recorder);
 CALLFUN_3(CppField__get);
 CALLFUN_4(CppField__set);
+CALLFUN_4(CppMethod__invoke_batch);
 
 CALLFUN_0(rcpp_capabilities) ;
 CALLFUN_0(rcpp_can_use_cxx0x) ;